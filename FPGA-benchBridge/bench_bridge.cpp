@@ -0,0 +1,287 @@
+/**
+ *
+ * @file    bench_bridge.cpp
+ * @brief   FPGA-benchBridge
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Throughput measurement of a mapped memory range
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "bench_bridge.h"
+#include "rstools_time.h"			// rstools timestamps
+
+#include <atomic>
+#include <thread>
+#include <pthread.h>				// POSIX: pthread_setaffinity_np
+#include <sched.h>					// POSIX: CPU_SET
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BENCH_NEON 1
+#endif
+
+using namespace std;
+
+// Sink of the read values, so that the reads can not be removed
+static volatile uint64_t readSink;
+
+/*
+* One pass over the range, returns the accumulated read values
+*/
+typedef uint64_t (*benchKernel_t)(void* base, size_t length);
+
+template <typename T>
+__attribute__((noinline)) static uint64_t readPass(void* base, size_t length)
+{
+	volatile T* p = (volatile T*) base;
+	size_t n = length / sizeof(T);
+	T acc = 0;
+	for (size_t i = 0; i < n; i++)
+		acc ^= p[i];
+	return acc;
+}
+
+template <typename T>
+__attribute__((noinline)) static uint64_t writePass(void* base, size_t length)
+{
+	volatile T* p = (volatile T*) base;
+	size_t n = length / sizeof(T);
+	for (size_t i = 0; i < n; i++)
+		p[i] = (T) i;
+	return 0;
+}
+
+template <typename T>
+__attribute__((noinline)) static uint64_t rmwPass(void* base, size_t length)
+{
+	volatile T* p = (volatile T*) base;
+	size_t n = length / sizeof(T);
+	for (size_t i = 0; i < n; i++)
+		p[i] = p[i] + 1;
+	return 0;
+}
+
+#ifdef BENCH_NEON
+
+// 128-bit accesses with the NEON unit (one vld1/vst1 per access)
+__attribute__((noinline)) static uint64_t readPass128(void* base, size_t length)
+{
+	const uint32_t* p = (const uint32_t*) base;
+	uint32x4_t acc = vdupq_n_u32(0);
+	for (size_t i = 0; i < length / 4; i += 4)
+		acc = veorq_u32(acc, vld1q_u32(p + i));
+	return vgetq_lane_u32(acc, 0) ^ vgetq_lane_u32(acc, 3);
+}
+
+__attribute__((noinline)) static uint64_t writePass128(void* base, size_t length)
+{
+	uint32_t* p = (uint32_t*) base;
+	uint32x4_t value = vdupq_n_u32(0);
+	uint32x4_t one = vdupq_n_u32(1);
+	for (size_t i = 0; i < length / 4; i += 4)
+	{
+		vst1q_u32(p + i, value);
+		value = vaddq_u32(value, one);
+	}
+	return 0;
+}
+
+__attribute__((noinline)) static uint64_t rmwPass128(void* base, size_t length)
+{
+	uint32_t* p = (uint32_t*) base;
+	uint32x4_t one = vdupq_n_u32(1);
+	for (size_t i = 0; i < length / 4; i += 4)
+		vst1q_u32(p + i, vaddq_u32(vld1q_u32(p + i), one));
+	return 0;
+}
+
+#else
+
+// 128-bit accesses with the vector type of the compiler (e.g. SSE2 on the host)
+typedef uint32_t vec128_t __attribute__((vector_size(16)));
+
+__attribute__((noinline)) static uint64_t readPass128(void* base, size_t length)
+{
+	volatile vec128_t* p = (volatile vec128_t*) base;
+	vec128_t acc = { 0, 0, 0, 0 };
+	for (size_t i = 0; i < length / sizeof(vec128_t); i++)
+		acc ^= p[i];
+	return acc[0] ^ acc[3];
+}
+
+__attribute__((noinline)) static uint64_t writePass128(void* base, size_t length)
+{
+	volatile vec128_t* p = (volatile vec128_t*) base;
+	vec128_t value = { 0, 0, 0, 0 };
+	for (size_t i = 0; i < length / sizeof(vec128_t); i++)
+	{
+		p[i] = value;
+		value += 1;
+	}
+	return 0;
+}
+
+__attribute__((noinline)) static uint64_t rmwPass128(void* base, size_t length)
+{
+	volatile vec128_t* p = (volatile vec128_t*) base;
+	for (size_t i = 0; i < length / sizeof(vec128_t); i++)
+		p[i] = p[i] + 1;
+	return 0;
+}
+
+#endif
+
+/*
+*   @brief               Kernel of an operation and an access width
+*   @return              kernel or nullptr
+*/
+static benchKernel_t selectKernel(benchOp_t op, uint8_t width)
+{
+	static const benchKernel_t kernels[BENCH_OPS][5] =
+	{
+		{ readPass<uint8_t>,  readPass<uint16_t>,  readPass<uint32_t>,  readPass<uint64_t>,  readPass128 },
+		{ writePass<uint8_t>, writePass<uint16_t>, writePass<uint32_t>, writePass<uint64_t>, writePass128 },
+		{ rmwPass<uint8_t>,   rmwPass<uint16_t>,   rmwPass<uint32_t>,   rmwPass<uint64_t>,   rmwPass128 }
+	};
+
+	if (op >= BENCH_OPS) return nullptr;
+	switch (width)
+	{
+		case 8:   return kernels[op][0];
+		case 16:  return kernels[op][1];
+		case 32:  return kernels[op][2];
+		case 64:  return kernels[op][3];
+		case 128: return kernels[op][4];
+	}
+	return nullptr;
+}
+
+/*
+* Work of one core
+*/
+typedef struct
+{
+	benchKernel_t kernel;
+	uint8_t* base;
+	size_t length;
+	uint8_t cpu;
+	uint64_t duration_ns;
+	atomic<uint8_t>* ready;			// cores that finished the warm-up
+	uint8_t cores;
+	uint64_t passes;
+	uint64_t start;
+	uint64_t end;
+	bool pinned;
+} benchJob_t;
+
+static void benchWorker(benchJob_t* job)
+{
+	// Pin the core to its own CPU (fails if the CPU is not online)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(job->cpu, &set);
+	job->pinned = (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+
+	uint64_t acc = job->kernel(job->base, job->length);
+
+	// All cores start the measurement together
+	job->ready->fetch_add(1);
+	while (job->ready->load() < job->cores)
+		this_thread::yield();
+
+	job->passes = 0;
+	job->start = rsTimeNowNs();
+	uint64_t deadline = job->start + job->duration_ns;
+	do
+	{
+		acc ^= job->kernel(job->base, job->length);
+		job->passes++;
+		job->end = rsTimeNowNs();
+	} while (job->end < deadline);
+
+	readSink = acc;
+}
+
+bool benchRun(void* base, size_t length, benchOp_t op, uint8_t width, uint8_t cores, \
+	uint64_t duration_ms, benchResult_t* result)
+{
+	benchKernel_t kernel = selectKernel(op, width);
+	if ((kernel == nullptr) || (cores < 1) || (cores > BENCH_MAX_CORES)) return false;
+
+	size_t slice = (length / cores) & ~((size_t) BENCH_ALIGN - 1);
+	if (slice == 0) return false;
+
+	atomic<uint8_t> ready(0);
+	benchJob_t jobs[BENCH_MAX_CORES];
+	for (uint8_t i = 0; i < cores; i++)
+	{
+		jobs[i].kernel = kernel;
+		jobs[i].base = (uint8_t*) base + i * slice;
+		jobs[i].length = slice;
+		jobs[i].cpu = i;
+		jobs[i].duration_ns = duration_ms * 1000000ULL;
+		jobs[i].ready = &ready;
+		jobs[i].cores = cores;
+	}
+
+	// The first core runs in the calling thread
+	thread second;
+	if (cores > 1)
+		second = thread(benchWorker, &jobs[1]);
+	benchWorker(&jobs[0]);
+	if (second.joinable())
+		second.join();
+
+	// Release the pinning of the calling thread
+	cpu_set_t all;
+	CPU_ZERO(&all);
+	for (int i = 0; i < CPU_SETSIZE; i++) CPU_SET(i, &all);
+	pthread_setaffinity_np(pthread_self(), sizeof(all), &all);
+
+	result->op = op;
+	result->width = width;
+	result->cores = cores;
+	result->bytes = 0;
+	result->pinned = true;
+	uint64_t start = jobs[0].start;
+	uint64_t end = jobs[0].end;
+	for (uint8_t i = 0; i < cores; i++)
+	{
+		result->bytes += jobs[i].passes * slice;
+		result->pinned = result->pinned && jobs[i].pinned;
+		if (jobs[i].start < start) start = jobs[i].start;
+		if (jobs[i].end > end) end = jobs[i].end;
+	}
+	result->accesses = result->bytes / (width / 8);
+	result->time_ns = end - start;
+	return true;
+}
+
+const char* benchOpName(benchOp_t op)
+{
+	switch (op)
+	{
+		case BENCH_OP_READ:  return "read";
+		case BENCH_OP_WRITE: return "write";
+		case BENCH_OP_RMW:   return "rmw";
+		default: break;
+	}
+	return "unknown";
+}
+
+bool benchHasNeon(void)
+{
+#ifdef BENCH_NEON
+	return true;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,83 @@
+/**
+ *
+ * @file    bench_bridge.h
+ * @brief   FPGA-benchBridge
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Throughput measurement of a mapped memory range
+ *
+ * Every test repeats passes over the range with one access width until
+ * the duration is over. With two cores the range is split into two
+ * halves, each core works on its own half and the throughput is the sum
+ * of both. The first pass of every core is not measured (warm-up).
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef BENCH_BRIDGE_H
+#define BENCH_BRIDGE_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+// Alignment of the range (widest access)
+#define BENCH_ALIGN				16
+// Maximum number of cores
+#define BENCH_MAX_CORES			2
+
+/*
+* Measured operations
+*/
+typedef enum
+{
+	BENCH_OP_READ = 0,				// p[i]
+	BENCH_OP_WRITE,					// p[i] = pattern
+	BENCH_OP_RMW,					// p[i] = p[i] + 1
+	BENCH_OPS
+} benchOp_t;
+
+/*
+* Result of one test
+*/
+typedef struct
+{
+	benchOp_t op;
+	uint8_t width;					// access width in bits (8, 16, 32, 64 or 128)
+	uint8_t cores;					// number of cores
+	uint64_t bytes;					// transferred bytes of all cores
+	uint64_t accesses;				// accesses of all cores
+	uint64_t time_ns;				// first start to last end of all cores
+	bool pinned;					// every core ran on its own CPU
+} benchResult_t;
+
+/*
+*   @brief               Measure the throughput of one operation and access width
+*	@param	base		 mapped range (BENCH_ALIGN aligned)
+*	@param	length		 length of the range (multiple of BENCH_ALIGN * cores)
+*	@param	op			 operation
+*	@param	width		 access width in bits
+*	@param	cores		 number of cores (1 or 2)
+*	@param	duration_ms	 measure time per core
+*	@param	result		 result of the test
+*   @return              success (false: invalid width or cores)
+*/
+bool benchRun(void* base, size_t length, benchOp_t op, uint8_t width, uint8_t cores, \
+	uint64_t duration_ms, benchResult_t* result);
+
+/*
+*   @brief               Name of an operation ("read", "write", "rmw")
+*/
+const char* benchOpName(benchOp_t op);
+
+/*
+*   @brief               The 128-bit accesses use NEON (else a generic vector type)
+*/
+bool benchHasNeon(void);
+
+#endif // BENCH_BRIDGE_H
@@ -0,0 +1,310 @@
+/**
+ *
+ * @file    main.cpp
+ * @brief   FPGA-benchBridge
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools application to measure the throughput of the HPS-to-FPGA Bridges
+ * or of any range of the MPU address space
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#define VERSION "1.00"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/mman.h>				// POSIX: memory maping
+#include <fcntl.h>					// POSIX: "PROT_WRITE", "MAP_SHARED", ...
+#include <unistd.h>					// POSIX: for closing the Linux driver access
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "bench_bridge.h"			// throughput measurement
+
+using namespace std;
+
+// Default measure time per test
+#define BENCH_DEFAULT_DURATION_MS	200
+
+/*
+* Mapping of the measured range
+*/
+typedef enum
+{
+	BENCH_MAP_UNCACHED = 0,			// rstools mapping (memory driver with O_SYNC)
+	BENCH_MAP_CACHED,				// memory driver without O_SYNC
+	BENCH_MAP_ANON					// anonymous memory of the process (-mem)
+} benchMap_t;
+
+static const char* mapName(benchMap_t map)
+{
+	switch (map)
+	{
+		case BENCH_MAP_UNCACHED: return "uncached";
+		case BENCH_MAP_CACHED:   return "cached";
+		case BENCH_MAP_ANON:     return "memory";
+	}
+	return "unknown";
+}
+
+/*
+*	@brief  Map the range without O_SYNC (cached, if the kernel allows it for the range)
+*   @param  address 	physical start address
+*   @param  length		length of the range
+*   @param  map			page aligned mapping (for munmap)
+*   @param  mapLength	length of the mapping
+*	@return mapped range or nullptr
+*/
+void* mapCached(uint32_t address, size_t length, void** map, size_t* mapLength)
+{
+	const char* dev = getenv(RSMEM_ENV_DEV);
+	if ((dev == nullptr) || (dev[0] == '\0'))
+		dev = RSMEM_DEFAULT_DEV;
+
+	int fd = open(dev, O_RDWR);
+	if (fd < 0) return nullptr;
+
+	uint32_t base = address & ~((uint32_t) MAP_MASK);
+	*mapLength = length + (address - base);
+	*map = mmap(NULL, *mapLength, (PROT_READ | PROT_WRITE), MAP_SHARED, fd, (off_t) base);
+	// The mapping stays valid after closing the driver
+	close(fd);
+	if (*map == MAP_FAILED) return nullptr;
+	return (uint8_t*) *map + (address - base);
+}
+
+/*
+*	@brief  Print the help output
+*/
+void printHelp(void)
+{
+	cout << "----------------------------------------------------------------------------------------------" << endl;
+	cout << "|        Command to measure the throughput of a HPS-to-FPGA Bridge Interface                 |" << endl;
+	cout << "|                    or of a range of the MPU (HPS) Memory space                             |" << endl;
+	cout << "|                         Designed for Intel SoC FPGAs                                       |" << endl;
+	cout << "----------------------------------------------------------------------------------------------" << endl;
+	cout << "|$ FPGA-benchBridge -lw|hf|mpu [Offset in HEX] [Length] {Options}                            |" << endl;
+	cout << "|      L   Measure a range of a Bridge or of the MPU address space                           |" << endl;
+	cout << "|          Offset and Length must be multiples of 16, Length in DEC (K, M) or HEX (0x)       |" << endl;
+	cout << "|          e.g.: FPGA-benchBridge -lw 0 64K -op all -c all                                   |" << endl;
+	cout << "|$ FPGA-benchBridge -mem [Length] {Options}                                                  |" << endl;
+	cout << "|      L   Measure anonymous memory of the process (test of the benchmark itself)            |" << endl;
+	cout << "|                                                                                            |" << endl;
+	cout << "|      Options:                                                                              |" << endl;
+	cout << "|          -op  read|write|rmw|all          operations (default: read, -mem: all)            |" << endl;
+	cout << "|          -w   8|16|32|64|128|all          access width in bits (default: all)              |" << endl;
+	cout << "|          -c   1|2|all                     number of cores (default: 1)                     |" << endl;
+	cout << "|          -map uncached|cached|all         mapping of the range (default: uncached)         |" << endl;
+	cout << "|          -t   [ms]                        measure time per test (default: 200 ms)          |" << endl;
+	cout << "|          -csv                             output as CSV                                    |" << endl;
+	cout << "|          The write and rmw tests overwrite the range!                                      |" << endl;
+	cout << "|          With RSTOOLS_MEM_DEV=<file> a file is measured instead of /dev/mem                |" << endl;
+	cout << "----------------------------------------------------------------------------------------------" << endl;
+	cout << "| Vers.: "<<VERSION<<"                                                                                |"<<endl;
+	cout << "| Copyright (C) 2020-2022 rsyocto GmbH & Co. KG                                              |" << endl;
+	cout << "----------------------------------------------------------------------------------------------" << endl;
+}
+
+int main(int argc, const char* argv[])
+{
+	std::string space = (argc > 1) ? argv[1] : "";
+	bool anonMode = (space == "-mem");
+	if (!(((argc > 2) && anonMode) || ((argc > 3) && ((space == "-lw") || (space == "-hf") || (space == "-mpu")))))
+	{
+		printHelp();
+		return 0;
+	}
+
+	bool InputVailed = true;
+	uint64_t offset = 0;
+	uint64_t length = 0;
+	int first = anonMode ? 3 : 4;
+
+	if (anonMode)
+		InputVailed = (rsMemParseLength(argv[2], &length) == RSMEM_SUCCESS);
+	else
+	{
+		std::string offsetStr = argv[2];
+		if ((offsetStr.compare(0, 2, "0x") != 0) && (offsetStr.compare(0, 2, "0X") != 0))
+			offsetStr = "0x" + offsetStr;
+		InputVailed = (rsMemParseLength(offsetStr.c_str(), &offset) == RSMEM_SUCCESS) && \
+			(rsMemParseLength(argv[3], &length) == RSMEM_SUCCESS);
+	}
+
+	// Selected tests
+	vector<benchOp_t> ops;
+	vector<uint8_t> widths = { 8, 16, 32, 64, 128 };
+	vector<uint8_t> cores = { 1 };
+	vector<benchMap_t> maps = { anonMode ? BENCH_MAP_ANON : BENCH_MAP_UNCACHED };
+	uint64_t duration_ms = BENCH_DEFAULT_DURATION_MS;
+	bool csv = false;
+
+	// Reading a Bridge is harmless, writing only on request
+	if (anonMode)
+		ops = { BENCH_OP_READ, BENCH_OP_WRITE, BENCH_OP_RMW };
+	else
+		ops = { BENCH_OP_READ };
+
+	for (int i = first; (i < argc) && InputVailed; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-csv")
+		{
+			csv = true;
+			continue;
+		}
+		if (i+1 >= argc)
+		{
+			InputVailed = false;
+			break;
+		}
+		std::string val = argv[++i];
+
+		if (arg == "-op")
+		{
+			if (val == "read")		 ops = { BENCH_OP_READ };
+			else if (val == "write") ops = { BENCH_OP_WRITE };
+			else if (val == "rmw")	 ops = { BENCH_OP_RMW };
+			else if (val == "all")	 ops = { BENCH_OP_READ, BENCH_OP_WRITE, BENCH_OP_RMW };
+			else InputVailed = false;
+		}
+		else if (arg == "-w")
+		{
+			if (val == "all") widths = { 8, 16, 32, 64, 128 };
+			else if ((val == "8") || (val == "16") || (val == "32") || (val == "64") || (val == "128"))
+				widths = { (uint8_t) atoi(val.c_str()) };
+			else InputVailed = false;
+		}
+		else if (arg == "-c")
+		{
+			if (val == "1")		   cores = { 1 };
+			else if (val == "2")   cores = { 2 };
+			else if (val == "all") cores = { 1, 2 };
+			else InputVailed = false;
+		}
+		else if ((arg == "-map") && !anonMode)
+		{
+			if (val == "uncached")	  maps = { BENCH_MAP_UNCACHED };
+			else if (val == "cached") maps = { BENCH_MAP_CACHED };
+			else if (val == "all")	  maps = { BENCH_MAP_UNCACHED, BENCH_MAP_CACHED };
+			else InputVailed = false;
+		}
+		else if (arg == "-t")
+		{
+			uint64_t value;
+			if ((rsMemParseLength(val.c_str(), &value) == RSMEM_SUCCESS) && (value > 0)) duration_ms = value;
+			else InputVailed = false;
+		}
+		else
+			InputVailed = false;
+	}
+
+	// The range must be aligned for the widest access and fit into the address space
+	uint32_t address = 0;
+	uint64_t range = anonMode ? UINT32_MAX : ((space == "-lw") ? LWH2F_RANGE : ((space == "-hf") ? H2F_RANGE : MPU_RANGE));
+	if (InputVailed)
+	{
+		if ((length == 0) || (length % BENCH_ALIGN) || (offset % BENCH_ALIGN) || (offset + length - 1 > range))
+			InputVailed = false;
+		else if (!anonMode && (rsMemSpaceAddress(space.c_str(), (uint32_t) offset, &address) != RSMEM_SUCCESS))
+			InputVailed = false;
+	}
+
+	if (!InputVailed)
+	{
+		cout << "[ ERROR ] User Input is wrong!" << endl;
+		cout << "          FPGA-benchBridge -lw|hf|mpu <Offset in HEX> <Length> {Options}" << endl;
+		cout << "          FPGA-benchBridge -mem <Length> {Options}" << endl;
+		cout << "          Offset and Length must be multiples of " << BENCH_ALIGN << " inside the address space" << endl;
+		return 1;
+	}
+
+	if (csv)
+		cout << "map,op,width,cores,bytes,time_ns,mb_s,ns_per_access" << endl;
+	else
+	{
+		cout << "[ INFO ] Range: 0x" << hex << address << " - 0x" << (address + length - 1) << dec << " (" \
+			<< length << " Bytes), " << duration_ms << " ms per test, 128-bit accesses " \
+			<< (benchHasNeon() ? "with NEON" : "without NEON") << endl;
+		cout << "  map       op     width  cores          MB/s    ns/access" << endl;
+	}
+
+	bool success = true;
+	bool pinWarning = false;
+	for (size_t m = 0; (m < maps.size()) && success; m++)
+	{
+		void* base = nullptr;
+		void* map = nullptr;
+		size_t mapLength = length;
+		if (maps[m] == BENCH_MAP_ANON)
+		{
+			map = mmap(NULL, length, (PROT_READ | PROT_WRITE), MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			// Fault in all pages before the measurement
+			if (map != MAP_FAILED)
+			{
+				base = map;
+				memset(base, 0, length);
+			}
+		}
+		else if (maps[m] == BENCH_MAP_CACHED)
+			base = mapCached(address, length, &map, &mapLength);
+		else
+			base = (void*) rsMemMap(address, (uint32_t) length);
+
+		if (base == nullptr)
+		{
+			cout << "[ ERROR ] Failed to map the range (" << mapName(maps[m]) << ")!" << endl;
+			success = false;
+			break;
+		}
+
+		for (size_t o = 0; o < ops.size(); o++)
+		{
+			for (size_t w = 0; w < widths.size(); w++)
+			{
+				for (size_t c = 0; c < cores.size(); c++)
+				{
+					benchResult_t res;
+					if (!benchRun(base, length, ops[o], widths[w], cores[c], duration_ms, &res))
+						continue;
+					if (!res.pinned && (res.cores > 1))
+						pinWarning = true;
+
+					double mbs = (res.time_ns > 0) ? (res.bytes * 1000.0 / res.time_ns) : 0;
+					double nsAccess = (res.accesses > 0) ? ((double) res.time_ns * res.cores / res.accesses) : 0;
+					char line[160];
+					if (csv)
+						snprintf(line, sizeof(line), "%s,%s,%u,%u,%llu,%llu,%.2f,%.3f", mapName(maps[m]), \
+							benchOpName(res.op), res.width, res.cores, (unsigned long long) res.bytes, \
+							(unsigned long long) res.time_ns, mbs, nsAccess);
+					else
+						snprintf(line, sizeof(line), "  %-9s %-6s %5u  %5u  %12.2f  %11.3f", mapName(maps[m]), \
+							benchOpName(res.op), res.width, res.cores, mbs, nsAccess);
+					cout << line << endl;
+				}
+			}
+		}
+
+		// The uncached windows are released by rsMemClose()
+		if (maps[m] != BENCH_MAP_UNCACHED)
+			munmap(map, mapLength);
+	}
+	rsMemClose();
+
+	if (pinWarning && !csv)
+		cout << "[ WARNING ] The cores could not be pinned to CPU 0 and 1, the dual core results share a CPU" << endl;
+	if (!csv && success && (maps.size() > 1))
+		cout << "[ INFO ] The kernel maps ranges outside of the SDRAM always uncached (also without O_SYNC)" << endl;
+
+	return success ? 0 : 1;
+}
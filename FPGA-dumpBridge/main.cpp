@@ -13,12 +13,22 @@
  * 			Initial release
  * 		1.01 (03-14-2022)
  * 			Bug fix in base address of dump
+ * 		1.10 (10-16-2026)
+ * 			Raw binary streaming mode without row limit
+ * 		1.11 (10-16-2026)
+ * 			Table-driven formatter with a single write per block of rows
+ * 		1.20 (10-16-2026)
+ * 			Table dump over the rstoolsd daemon
+ * 		1.30 (10-16-2026)
+ * 			Verify mode against a binary reference file
+ * 		1.40 (10-16-2026)
+ * 			Raw binary streaming over the rstoolsd daemon
  * 
  * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
  * 
  */
 
-#define VERSION "1.01"
+#define VERSION "1.40"
 
 #include <cstdio>
 #include <iostream>
@@ -30,7 +40,13 @@
 #include <thread>					// Required for putting task to sleep 
 #include <chrono>					// Required for putting task to sleep 
 #include <sstream>
+#include <cstring>
+#include <vector>
 #include <bits/stdc++.h>
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_block.h"			// rstools block transfers
+#include "rstools_time.h"			// rstools timestamps
+#include <sys/stat.h>				// POSIX: fstat
 
 using namespace std;
 
@@ -38,25 +54,6 @@ using namespace std;
 #define APP_MAX_ROW			280 	// Maximum number of allowed print-out rows
 
 
-// Bridge Interfaces Base addresses 
-#define LWHPSFPGA_OFST  	0xff200000 // LWHPS2FPGA Bridge 
-#define HPSFPGA_OFST    	0xC0000000 // HPS2FPGA Bridge 
-#define MPU_OFSET			0x0        // MPU (HPS Address space)
-
-#define FPGAMAN_GPI_OFST    0xFF706014
-
-// Bridge interface End address 
-#define LWHPSFPGA_END   	0xFF3FFFFF
-#define HPSFPGA_END     	0xFBFFFFFF
-#define MPU_END         	0xFFFFFFFF
-// Bridge interface range (allowed input offset)
-#define LWH2F_RANGE    (LWHPSFPGA_END - LWHPSFPGA_OFST)
-#define H2F_RANGE      (HPSFPGA_END - HPSFPGA_OFST)
-#define MPU_RANGE      (MPU_END - MPU_OFSET)
-
-#define MAP_SIZE 4096UL
-#define MAP_MASK (MAP_SIZE - 1)
-
 // Auto refresh Mode settings
 #define REFRECHMODE_DELAY_MS	50
 #define REFRECHMODE_DURATION_MS 15000
@@ -88,23 +85,297 @@ bool checkIfInputIsVailed(std::string input, bool DecHex)
 	return false;
 }
 
+// Formatted dump output
+#define DUMP_BLOCK_ROWS		256		// Number of rows rendered before one write
+#define DUMP_ROW_MAXLEN		128		// Maximum length of a rendered row
+
+static const char hexDigits[] = "0123456789abcdef";
+
+/*
+*	@brief  Table with the character of every byte for the ASCII column
+*			(non printable bytes are shown as space)
+*/
+struct asciiTable_t
+{
+	char c[256];
+	asciiTable_t()
+	{
+		for (int i = 0; i < 256; i++)
+			c[i] = ((i < 32) || (i > 126)) ? ' ' : (char) i;
+	}
+};
+static const asciiTable_t asciiTable;
+
 /*
-*	@param  Add spaces to a string to achieve a specific length
-*   @param  input 		String as input
+*	@brief  Write a value as HEX String (lower case, no leading zeros)
+*			and add spaces to achieve a specific length
+*   @param  out 		output buffer
+*   @param  value		value to write
 *   @param  len			total length to achieve
-*	@return string with the total length
+*	@return pointer behind the written chars
 */
-std::string fixStrlen(std::string input, uint8_t len)
+static inline char* putHex(char* out, uint32_t value, uint8_t len)
 {
-	std::string output=input;
-	for(uint8_t i=input.length(); i<len;i++)
+	char digits[8];
+	uint8_t n = 0;
+	do
 	{
-		output = output + ' ';
+		digits[n++] = hexDigits[value & 0xF];
+		value >>= 4;
+	} while (value);
+
+	for (uint8_t i = n; i > 0; i--)
+		*out++ = digits[i-1];
+	for (; n < len; n++)
+		*out++ = ' ';
+	return out;
+}
+
+/*
+*	@brief  Write a value as DEC String and add spaces to achieve a specific length
+*   @param  out 		output buffer
+*   @param  value		value to write
+*   @param  len			total length to achieve
+*	@return pointer behind the written chars
+*/
+static inline char* putDec(char* out, uint32_t value, uint8_t len)
+{
+	char digits[10];
+	uint8_t n = 0;
+	do
+	{
+		digits[n++] = '0' + (value % 10);
+		value /= 10;
+	} while (value);
+
+	for (uint8_t i = n; i > 0; i--)
+		*out++ = digits[i-1];
+	for (; n < len; n++)
+		*out++ = ' ';
+	return out;
+}
+
+/*
+*	@brief  Copy a string literal into the output buffer
+*/
+template <size_t N>
+static inline char* putStr(char* out, const char (&str)[N])
+{
+	memcpy(out, str, N-1);
+	return out + N-1;
+}
+
+/*
+*	@brief  Render one row of the memory dump
+*   @param  out 		output buffer (at least DUMP_ROW_MAXLEN chars)
+*   @param  row			offset of the row
+*   @param  address		address of the row
+*   @param  data		4 32-bit values of the row
+*   @param  decMode		True  ==> DEC Mode
+*   					False ==> HEX Mode
+*	@return pointer behind the row
+*/
+static char* renderRow(char* out, uint32_t row, uint32_t address, const uint32_t* data, bool decMode)
+{
+	// At the beginning of the row print the address
+	out = putStr(out, "| 0x");
+	out = putHex(out, row, 6);
+	out = putStr(out, "| 0x");
+	out = putHex(out, address, 10);
+	out = putStr(out, "||");
+
+	// Write to each Column 4 32-bit values
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		uint32_t value = data[i];
+		if (!decMode)
+		{
+			*out++ = ' ';
+			out = putHex(out, value >> 16, 4);
+			out = putStr(out, "  ");
+			out = putHex(out, value & 0xFFFF, 4);
+			out = (i < 3) ? putStr(out, " | ") : putStr(out, "    ");
+		}
+		else
+		{
+			// For DEC Output Format Mode
+			*out++ = ' ';
+			out = putDec(out, value, 10);
+			out = (i < 3) ? putStr(out, " |") : putStr(out, "     ");
+		}
+	}
+
+	// Convert row to 16 ASCII Chars
+	out = putStr(out, "|| ");
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		uint32_t value = data[i];
+		*out++ = asciiTable.c[(value >> 24) & 0xFF];
+		*out++ = asciiTable.c[(value >> 16) & 0xFF];
+		*out++ = asciiTable.c[(value >> 8) & 0xFF];
+		*out++ = asciiTable.c[value & 0xFF];
+	}
+	*out++ = '\n';
+	return out;
+}
+
+
+/*
+*	@brief  Stream a range read over rstoolsd to a file descriptor
+*			The range is read in chunks of RSBLOCK_CHUNK_SIZE (one batch each)
+*   @param  fd	 		output file
+*   @param  address 	physical start address
+*   @param  length		number of bytes (multiple of 4)
+*	@return success
+*/
+bool dumpRawRemote(int fd, uint32_t address, uint32_t length)
+{
+	vector<uint32_t> chunk(RSBLOCK_CHUNK_SIZE / 4);
+
+	while (length > 0)
+	{
+		uint32_t len = (length > RSBLOCK_CHUNK_SIZE) ? RSBLOCK_CHUNK_SIZE : length;
+		if ((rsMemReadBlock(address, chunk.data(), len) != RSMEM_SUCCESS) || \
+			!rsBlockWriteFd(fd, chunk.data(), len))
+			return false;
+
+		address += len;
+		length  -= len;
+	}
+	return true;
+}
+
+/*
+*	@brief  Compare a range with a binary reference file and print the runs of
+*			mismatching 32-bit words
+*			The range is read in chunks with 32-bit accesses (or over rstoolsd) and compared with the
+*			mapped file with 16 Byte vectors
+*   @param  address 	physical start address
+*   @param  length		number of bytes to compare (multiple of 4)
+*   @param  refFile		reference file (at least length Bytes)
+*	@return true if the range is equal to the file
+*/
+bool runVerify(uint32_t address, uint32_t length, const std::string& refFile)
+{
+	if (length == 0)
+	{
+		cout << "[ ERROR ] Select at least one 32-bit word to compare!" << endl;
+		return false;
+	}
+
+	int ref_fd = open(refFile.c_str(), O_RDONLY);
+	struct stat st;
+	if ((ref_fd < 0) || (fstat(ref_fd, &st) != 0))
+	{
+		cout << "[ ERROR ] Failed to open the reference file!" << endl;
+		if (ref_fd >= 0) close(ref_fd);
+		return false;
+	}
+	if ((uint64_t) st.st_size < length)
+	{
+		cout << "[ ERROR ] The reference file has only " << st.st_size << " of " << length << " Bytes!" << endl;
+		close(ref_fd);
+		return false;
 	}
-	return output;
-} 
 
+	// The mapping of the file is page aligned (32-bit aligned words)
+	const uint32_t* ref = (const uint32_t*) mmap(NULL, length, PROT_READ, MAP_PRIVATE, ref_fd, 0);
+	close(ref_fd);
+	if (ref == (const uint32_t*) MAP_FAILED)
+	{
+		cout << "[ ERROR ] Failed to map the reference file!" << endl;
+		return false;
+	}
+
+	bool ok = false;
+	do
+	{
+		// open memory driver 
+		if (rsMemOpen() != RSMEM_SUCCESS)
+		{
+			cout << "[ ERROR ] Failed to open memory driver!" << endl;
+			break;
+		}
+
+		// map the entire range once (with rstoolsd the chunks are read by the daemon)
+		if (!rsMemIsRemote() && (rsMemMap(address, length) == nullptr))
+		{
+			cout << "[ ERROR ]  Accessing the virtual memory failed!" << endl;
+			break;
+		}
+
+		vector<uint32_t> chunk(RSBLOCK_CHUNK_SIZE / 4);
+		bool readOk = true;
+		size_t words = length / 4;
+		size_t runStart = 0;
+		bool inRun = false;
+		uint64_t mismatches = 0;
+		uint64_t runs = 0;
+		char line[96];
+
+		uint64_t start = rsTimeNowNs();
+		for (size_t first = 0; first < words; first += chunk.size())
+		{
+			size_t count = min(chunk.size(), words - first);
+			if (rsMemReadBlock(address + (uint32_t) first * 4, chunk.data(), (uint32_t) count * 4) != RSMEM_SUCCESS)
+			{
+				readOk = false;
+				break;
+			}
+
+			// Alternate between the start and the end of the mismatch runs
+			size_t i = 0;
+			while (i < count)
+			{
+				if (!inRun)
+				{
+					i = rsBlockFindDiff(chunk.data(), ref + first, count, i);
+					if (i == count) break;
+					runStart = first + i;
+					inRun = true;
+				}
+				size_t end = rsBlockFindSame(chunk.data(), ref + first, count, i);
+				mismatches += end - i;
+				i = end;
+				if (i == count) break;
+
+				inRun = false;
+				runs++;
+				snprintf(line, sizeof(line), "   0x%08x - 0x%08x  %10llu words", address + (uint32_t) runStart * 4, \
+					address + (uint32_t) (first + i) * 4 - 1, (unsigned long long) (first + i - runStart));
+				cout << line << "\n";
+			}
+		}
+		if (inRun)
+		{
+			runs++;
+			snprintf(line, sizeof(line), "   0x%08x - 0x%08x  %10llu words", address + (uint32_t) runStart * 4, \
+				address + length - 1, (unsigned long long) (words - runStart));
+			cout << line << "\n";
+		}
+		uint64_t time_ns = rsTimeNowNs() - start;
+		if (!readOk)
+		{
+			cout << "[ ERROR ]  Reading the range failed!" << endl;
+			break;
+		}
+
+		cout << "[ INFO ] " << length << " Bytes of 0x" << hex << address << dec << " compared with " << refFile \
+			 << " in " << time_ns / 1000 << " us";
+		if (time_ns > 0)
+			cout << " (" << ((uint64_t) length * 1000) / time_ns << " MB/s)";
+		cout << endl;
+		if (mismatches > 0)
+			cout << "[ ERROR ] " << mismatches << " mismatching words in " << runs << " runs" << endl;
+		else
+			cout << "[ SUCCESS ] The range is equal to the reference file" << endl;
+		ok = (mismatches == 0);
+	} while (0);
 
+	rsMemClose();
+	munmap((void*) ref, length);
+	return ok;
+}
 
 int main(int argc, const char* argv[])
 {
@@ -147,6 +418,24 @@ int main(int argc, const char* argv[])
 		if ((argc > 4) && (std::string(argv[5]) == "-d"))
 			decMode = true;
 
+		// Check if the raw binary streaming mode was enabled
+		bool rawMode = false;
+		std::string rawFile;
+		if ((argc > 5) && (std::string(argv[5]) == "-o"))
+		{
+			rawMode = true;
+			rawFile = argv[6];
+		}
+
+		// Check if the verify mode was enabled
+		bool verifyMode = false;
+		std::string refFile;
+		if ((argc > 5) && (std::string(argv[5]) == "-v"))
+		{
+			verifyMode = true;
+			refFile = argv[6];
+		}
+
 		/// Check the user inputs ///
 		std::string AddresshexString = argv[2];
 		std::string AddressEndStr	 = argv[4];
@@ -160,8 +449,8 @@ int main(int argc, const char* argv[])
 			istringstream buffer2(AddressEndStr);
 			buffer2 >> hex >> addressEndOffset;
 
-			// Check for max Row 
-			if(addressEndOffset > APP_MAX_ROW*16)
+			// Check for max Row (only for the formatted output)
+			if((!rawMode) && (!verifyMode) && (addressEndOffset > APP_MAX_ROW*16))
 			{
 				cout << "[ ERROR ]  Maximum number of rows "<<APP_MAX_ROW<<" reached !" << endl;
 				cout << "           Maximum allowed range is: 0x"<<hex<<APP_MAX_ROW*16<<" reached !" <<dec<< endl;
@@ -188,7 +477,7 @@ int main(int argc, const char* argv[])
 			if (address_space == 0)
 			{
 				// check the range of the AXI HPS-to-FPGA Bridge Interface 
-				if ((addressStartOffset+addressEndOffset) > H2F_RANGE)
+				if (((uint64_t) addressStartOffset+addressEndOffset) > H2F_RANGE)
 				{
 
 					cout << "[ ERROR ]  Selected Address is outside of the HPS to "\
@@ -197,10 +486,10 @@ int main(int argc, const char* argv[])
 				}
 			}
 			// LWHPS2FPGA
-			else if ((addressStartOffset+addressEndOffset)==1)
+			else if (address_space == 1)
 			{
 				// check the range of the Lightweight HPS-to-FPGA Bridge Interface 
-				if ((addressStartOffset+addressEndOffset) > LWH2F_RANGE)
+				if (((uint64_t) addressStartOffset+addressEndOffset) > LWH2F_RANGE)
 				{
 
 					cout << "[ ERROR ] Selected Address is outside of"\
@@ -212,7 +501,7 @@ int main(int argc, const char* argv[])
 			else
 			{
 				// check the range of the MPU address space
-				if ((addressStartOffset+addressEndOffset) > MPU_RANGE)
+				if (((uint64_t) addressStartOffset+addressEndOffset) > MPU_RANGE)
 				{
 					cout << "[  ERROR  ] Selected address is outside of"\
 					"the HPS Address Range!" << endl;
@@ -235,8 +524,78 @@ int main(int argc, const char* argv[])
 		
 		address_end  = address_start +addressEndOffset;
  
+		// Compare the range with a reference file
+		if (InputVailed && verifyMode)
+		{
+			if (!runVerify(address_start, addressEndOffset, refFile))
+				return 1;
+		}
+		// Raw binary streaming of the range to a file or stdout
+		else if (InputVailed && rawMode)
+		{
+			bool toStdout = (rawFile == "-");
+			int out_fd = toStdout ? STDOUT_FILENO : open(rawFile.c_str(), (O_WRONLY | O_CREAT | O_TRUNC), 0644);
+
+			do
+			{
+				if (out_fd < 0)
+				{
+					cerr << "[ ERROR ] Failed to open the output file!" << endl;
+					break;
+				}
+
+				// open memory driver 
+				if (rsMemOpen() != RSMEM_SUCCESS)
+				{
+					cerr << "[ ERROR ] Failed to open memory driver!" << endl;
+					break;
+				}
+
+				auto start = std::chrono::steady_clock::now();
+				if (rsMemIsRemote())
+				{
+					// the daemon reads the range in chunks
+					if (!dumpRawRemote(out_fd, address_start, addressEndOffset))
+					{
+						cerr << "[ ERROR ] Reading the range over rstoolsd or writing the output failed!" << endl;
+						break;
+					}
+				}
+				else
+				{
+					// map the entire range once 
+					volatile uint32_t* bridgeMap = rsMemMap(address_start, addressEndOffset);
+					if (bridgeMap == nullptr)
+					{
+						cerr << "[ ERROR ]  Accessing the virtual memory failed!" << endl;
+						break;
+					}
+
+					if (!rsBlockDevToFd(out_fd, bridgeMap, addressEndOffset))
+					{
+						cerr << "[ ERROR ] Writing the output failed!" << endl;
+						break;
+					}
+				}
+				double duration_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+				if (!toStdout)
+				{
+					cout << "[ INFO ] " << addressEndOffset << " Bytes of 0x" << hex << address_start << " : " << address_end << dec \
+						 << " written to " << rawFile;
+					if (duration_s > 0)
+						cout << " (" << (addressEndOffset / duration_s / (1024*1024)) << " MiB/s)";
+					cout << endl;
+				}
+			} while (0);
+
+			// Close the MAP, the driver port and the output file 
+			rsMemClose();
+			if ((!toStdout) && (out_fd >= 0))
+				close(out_fd);
+		}
 		// only in case the input is valid read the bridge
-		if (InputVailed)
+		else if (InputVailed)
 		{
 			cout << "---------------------------------------- MEMORY DUMP --------------------------------------------------" << endl;
 			if (address_space < 2)
@@ -257,31 +616,21 @@ int main(int argc, const char* argv[])
 		
 			do
 			{
-				void* bridgeMap;
-				int fd;
-
 				// open memory driver 
-				fd = open("/dev/mem", (O_RDWR | O_SYNC));
-
-				// was opening okay
-				if (fd < 0)
+				if (rsMemOpen() != RSMEM_SUCCESS)
 				{
 					cout << "[ ERROR ] Failed to open memory driver!" << endl;
+					break;
 				}
 
-				bridgeMap = mmap(NULL, addressEndOffset, PROT_READ, MAP_PRIVATE, fd, \
-						address_start & ~MAP_MASK);
-
-				// check if opening was successfully
-				if (bridgeMap == MAP_FAILED)
+				// map the entire range once (the last row is included)
+				// with rstoolsd the blocks are read by the daemon instead
+				if (!rsMemIsRemote() && (rsMemMap(address_start, addressEndOffset+16) == nullptr))
 				{
 					cout << "[ ERROR ]  Accessing the virtual memory failed!" << endl;
-					close(fd);
+					rsMemClose();
 					break;
 				}
-				void* readMap = bridgeMap + (address_start & MAP_MASK);
-				uint32_t address_curent =0;
-				
 				if (!decMode)
 				{
 					// For the HEX Format Output Mode
@@ -297,75 +646,31 @@ int main(int argc, const char* argv[])
 					cout << "-------------------------------------------------------------------------------------------------------" << endl;
 				}
 				
-				// Write row after row 
-				for (uint16_t row=0; row<=addressEndOffset; row+=16)
+				// Write block after block of rows with a single write per block
+				uint32_t rows = addressEndOffset/16 + 1;
+				vector<uint32_t> blockData(DUMP_BLOCK_ROWS*4);
+				vector<char> blockText(DUMP_BLOCK_ROWS*DUMP_ROW_MAXLEN);
+
+				for (uint32_t blockRow = 0; blockRow < rows; blockRow += DUMP_BLOCK_ROWS)
 				{
-					// calucate the addresss for the row
-					address_curent = address_start+row;
-					
-					// At the beginning of the row print  the address
-					std::stringstream stream;
-					stream << std::hex << row;    
-					cout << "| 0x"<<fixStrlen(stream.str(),6);
-					stream.str(std::string());
-					stream << std::hex << address_curent;
-					cout << "| 0x"<<fixStrlen(stream.str(),10)<<"||";
-					std::string ascii ="";
-
-					// Write to each Column 4 32-bit values 
-					for (uint16_t i = 0; i < 16; i+=4)
+					uint32_t blockRows = min<uint32_t>(DUMP_BLOCK_ROWS, rows - blockRow);
+
+					// read the 32-Bit Values of the block
+					if (rsMemReadBlock(address_start + blockRow*16, blockData.data(), blockRows*16) != RSMEM_SUCCESS)
 					{
-						// read the 32-Bit Value 
-						readMap = bridgeMap + ((address_curent+i) & MAP_MASK);
-						uint32_t value = *((uint32_t*)readMap);
-						// value= (uint32_t) 0x416231; // ASCII = "Ab1"
-						// read the high byte
-						uint16_t hi	= (value >> 16);
-						uint16_t lo	= (value & 0xFFFF);
-						
-						if(!decMode)
-						{
-							stream.str(std::string());
-							stream << std::hex << hi;
-							cout << " "<<fixStrlen(stream.str(),4);
-
-							// read the low byte
-							stream.str(std::string());
-							stream << std::hex << lo;
-							if (i<12)
-								cout<<"  "<<fixStrlen(stream.str(),4) <<" | ";
-							else
-								cout<<"  "<<fixStrlen(stream.str(),4) <<"    ";
-						}
-						else
-						{	
-							// For DEC Output Format Mode
-							if (i<12)
-								cout<<" "<<fixStrlen(to_string(value),10) <<" |";
-							else 
-								cout<<" "<<fixStrlen(to_string(value),10) <<"     ";
-						}
-					
-						
-						// Convert row to 16 ASCII Chars 
-						
-						ascii += stoul(to_string ((hi & 0xFF00)>>8), nullptr, 10);
-						ascii += stoul(to_string (hi & 0x00FF), nullptr, 10);
-						ascii += stoul(to_string ((lo & 0xFF00)>>8), nullptr, 10);
-						ascii += stoul(to_string (lo & 0x00FF), nullptr, 10);
-						
+						cout << "[ ERROR ]  Accessing the virtual memory failed!" << endl;
+						break;
 					}
-					cout << "|| ";
-					// Remove New Line feeds and unkwon ASCII of ASCII String  
-					for (int i = 0; i < ascii.length();i++) 
+
+					char* out = blockText.data();
+					for (uint32_t i = 0; i < blockRows; i++)
 					{
-						if (((uint8_t) ascii[i] <32) || ((uint8_t) ascii[i] >126))
-						{
-							ascii[i] = ' ';
-						}
-					}				
-					cout <<ascii<< endl;
+						uint32_t row = (blockRow + i)*16;
+						out = renderRow(out, row, address_start+row, &blockData[i*4], decMode);
+					}
+					cout.write(blockText.data(), out - blockText.data());
 				}
+				cout.flush();
 				if (addressEndOffset>100)
 				{																							
 					if (!decMode)
@@ -383,14 +688,8 @@ int main(int argc, const char* argv[])
 						cout << "-------------------------------------------------------------------------------------------------------" << endl;
 					}
 				}
-				// Close the MAP 
-				if (munmap(bridgeMap, addressEndOffset) < 0)
-				{
-					cout << "[ ERROR ] Closing of shared memory failed!" << endl;
-				}
-
-				// Close the driver port 
-				close(fd);
+				// Close the MAP and the driver port 
+				rsMemClose();
 
 			} while (0);
 		}
@@ -398,6 +697,8 @@ int main(int argc, const char* argv[])
 		{
 			cout << "[ ERROR ] User Input is wrong!"<<endl;
 			cout <<	"          FPGA-dumpBridge -lw|hf|mpu <Address Offset in HEX> : <Offset to Dump in HEX>  -d"<< endl;
+			cout <<	"          FPGA-dumpBridge -lw|hf|mpu <Address Offset in HEX> : <Bytes to Dump in HEX>  -o <File|->"<< endl;
+			cout <<	"          FPGA-dumpBridge -lw|hf|mpu <Address Offset in HEX> : <Bytes to Compare in HEX>  -v <File>"<< endl;
 			
 		}
 	}
@@ -421,6 +722,13 @@ int main(int argc, const char* argv[])
 		cout << "|                                                                                            |" << endl;
 		cout << "|      Suffix: -d -> Dump as uint32_t DEC                                                    |" << endl;
 		cout << "|$ FPGA-dumpBridge -lw|hf|mpu <Address Offset in HEX> : <Offset to Dump in HEX>  -d          |" << endl;
+		cout << "|$ FPGA-dumpBridge -lw|hf|mpu <Address Offset in HEX> : <Bytes to Dump in HEX>  -o <File|->  |" << endl;
+		cout << "|      L   Raw binary streaming of the range to a file or with - to stdout                   |" << endl;
+		cout << "|          No row limit, e.g.: FPGA-dumpBridge -hf 0 : 100000 -o snapshot.bin                |" << endl;
+		cout << "|$ FPGA-dumpBridge -lw|hf|mpu <Address Offset in HEX> : <Bytes to Compare in HEX>  -v <File> |" << endl;
+		cout << "|      L   Compare the range with a binary reference file, only the runs of mismatching      |" << endl;
+		cout << "|          32-bit words are printed, exit code 1 on a mismatch                               |" << endl;
+		cout << "|          e.g.: FPGA-dumpBridge -hf 0 : 40000 -v firmware.bin                               |" << endl;
 		cout << "----------------------------------------------------------------------------------------------" << endl;
 		cout << "| Vers.: "<<VERSION<<"                                                                                |"<<endl;
 		cout << "| Copyright (C) 2021-2022 rsyocto GmbH & Co. KG                                              |" << endl;
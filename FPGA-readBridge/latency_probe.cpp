@@ -0,0 +1,174 @@
+/**
+ *
+ * @file    latency_probe.cpp
+ * @brief   FPGA-readBridge
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Latency of single accesses to one register with a histogram
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "latency_probe.h"
+#include "rstools_time.h"			// rstools timestamps
+
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Wait until a write left the CPU (a write is otherwise only posted to the store buffer)
+#if defined(__arm__) || defined(__aarch64__)
+#define LATENCY_WRITE_BARRIER()		__asm__ volatile("dsb sy" ::: "memory")
+#else
+#define LATENCY_WRITE_BARRIER()		__sync_synchronize()
+#endif
+
+// Width of the histogram bars
+#define LATENCY_BAR_WIDTH			30
+
+/*
+*   @brief               Bucket of a latency
+*/
+static uint32_t bucketIndex(uint32_t value)
+{
+	if (value < 2 * LATENCY_SUB_COUNT) return value;
+	uint32_t shift = (31 - __builtin_clz(value)) - LATENCY_SUB_BITS;
+	return (shift + 1) * LATENCY_SUB_COUNT + ((value >> shift) & (LATENCY_SUB_COUNT - 1));
+}
+
+/*
+*   @brief               Smallest latency of a bucket
+*/
+static uint64_t bucketLow(uint32_t index)
+{
+	if (index < 2 * LATENCY_SUB_COUNT) return index;
+	uint32_t shift = index / LATENCY_SUB_COUNT - 1;
+	return (uint64_t) (LATENCY_SUB_COUNT + index % LATENCY_SUB_COUNT) << shift;
+}
+
+/*
+*   @brief               Largest latency of a bucket
+*/
+static uint64_t bucketHigh(uint32_t index)
+{
+	if (index < 2 * LATENCY_SUB_COUNT) return index;
+	return bucketLow(index) + (1ULL << (index / LATENCY_SUB_COUNT - 1)) - 1;
+}
+
+/*
+*   @brief               Percentile of sorted samples (nearest rank)
+*/
+static uint32_t percentile(const vector<uint32_t>& sorted, double p)
+{
+	size_t rank = (size_t) (p * sorted.size() + 0.999999);
+	if (rank < 1) rank = 1;
+	if (rank > sorted.size()) rank = sorted.size();
+	return sorted[rank - 1];
+}
+
+/*
+*   @brief               Cost of an empty timing frame (minimum of LATENCY_OVERHEAD_COUNT)
+*/
+static uint64_t timerOverhead(void)
+{
+	uint64_t overhead = UINT64_MAX;
+	for (uint32_t i = 0; i < LATENCY_OVERHEAD_COUNT; i++)
+	{
+		uint64_t t0 = rsTimeRawNs();
+		uint64_t t1 = rsTimeRawNs();
+		if (t1 - t0 < overhead) overhead = t1 - t0;
+	}
+	return overhead;
+}
+
+bool runLatencyProbe(volatile uint32_t* reg, uint32_t address, const latencyCfg_t& cfg)
+{
+	// Allocate (and fault in) the samples before the measurement
+	vector<uint32_t> samples(cfg.count);
+	uint64_t overhead = timerOverhead();
+
+	// A write stores the current value again, the register keeps its content
+	uint32_t value = *reg;
+	volatile uint32_t sink;
+
+	for (uint64_t i = 0; i < cfg.count; i++)
+	{
+		uint64_t t0 = rsTimeRawNs();
+		if (cfg.write)
+		{
+			*reg = value;
+			LATENCY_WRITE_BARRIER();
+		}
+		else
+			sink = *reg;
+		uint64_t t1 = rsTimeRawNs();
+
+		uint64_t ns = (t1 - t0 > overhead) ? (t1 - t0 - overhead) : 0;
+		samples[i] = (ns > UINT32_MAX) ? UINT32_MAX : (uint32_t) ns;
+	}
+	(void) sink;
+
+	vector<uint64_t> hist(LATENCY_BUCKETS, 0);
+	uint64_t sum = 0;
+	for (uint32_t s : samples)
+	{
+		hist[bucketIndex(s)]++;
+		sum += s;
+	}
+	sort(samples.begin(), samples.end());
+
+	if (cfg.csv)
+	{
+		cout << "from_ns,to_ns,count,cumulative" << "\n";
+		uint64_t cumulative = 0;
+		for (uint32_t i = 0; i < LATENCY_BUCKETS; i++)
+		{
+			if (hist[i] == 0) continue;
+			cumulative += hist[i];
+			cout << bucketLow(i) << "," << bucketHigh(i) << "," << hist[i] << "," << cumulative << "\n";
+		}
+		cout.flush();
+		return true;
+	}
+
+	uint64_t peak = *max_element(hist.begin(), hist.end());
+	char line[160];
+
+	cout << "------------------------------------LATENCY------------------------------------------" << endl;
+	snprintf(line, sizeof(line), "   %llu %s of 0x%08x, timer overhead %llu ns (subtracted)", \
+		(unsigned long long) cfg.count, cfg.write ? "writes" : "reads", address, (unsigned long long) overhead);
+	cout << line << endl;
+	snprintf(line, sizeof(line), "   min: %u ns   median: %u ns   mean: %.1f ns", samples.front(), \
+		percentile(samples, 0.5), (double) sum / cfg.count);
+	cout << line << endl;
+	snprintf(line, sizeof(line), "   p99: %u ns   p99.9: %u ns   max: %u ns", percentile(samples, 0.99), \
+		percentile(samples, 0.999), samples.back());
+	cout << line << endl;
+	cout << "-------------------------------------------------------------------------------------" << endl;
+	cout << "     from ns        to ns        count  cumulative" << endl;
+
+	uint64_t cumulative = 0;
+	for (uint32_t i = 0; i < LATENCY_BUCKETS; i++)
+	{
+		if (hist[i] == 0) continue;
+		cumulative += hist[i];
+
+		// At least one mark for every used bucket
+		uint32_t bar = (uint32_t) ((hist[i] * LATENCY_BAR_WIDTH + peak - 1) / peak);
+		snprintf(line, sizeof(line), "  %10llu   %10llu   %10llu   %8.4f %%  %s", (unsigned long long) bucketLow(i), \
+			(unsigned long long) bucketHigh(i), (unsigned long long) hist[i], 100.0 * cumulative / cfg.count, \
+			string(bar, '#').c_str());
+		cout << line << endl;
+	}
+	cout << "-------------------------------------------------------------------------------------" << endl;
+	return true;
+}
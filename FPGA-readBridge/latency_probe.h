@@ -0,0 +1,62 @@
+/**
+ *
+ * @file    latency_probe.h
+ * @brief   FPGA-readBridge
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Latency of single accesses to one register with a histogram
+ *
+ * Every access is framed by two reads of CLOCK_MONOTONIC_RAW, the cost of an
+ * empty frame (timer overhead) is measured first and subtracted. The
+ * histogram is log-linear like a HDR histogram: every power of two is
+ * split into 2^LATENCY_SUB_BITS buckets, so a bucket is never wider than
+ * 1/16 (6.25 %) of its value. The percentiles are exact (sorted samples).
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+
+// Number of accesses without a count and the maximum (4 Byte per access)
+#define LATENCY_DEFAULT_COUNT		100000
+#define LATENCY_MAX_COUNT			10000000
+
+// Sub-buckets per power of two (2^4 = 16)
+#define LATENCY_SUB_BITS			4
+#define LATENCY_SUB_COUNT			(1 << LATENCY_SUB_BITS)
+// Buckets for 32-bit ns values
+#define LATENCY_BUCKETS				((32 - LATENCY_SUB_BITS + 1) * LATENCY_SUB_COUNT)
+
+// Empty frames to measure the timer overhead
+#define LATENCY_OVERHEAD_COUNT		1000
+
+/*
+* Configuration of the latency probe
+*/
+typedef struct
+{
+	uint64_t count;					// number of accesses
+	bool write;						// write the read value back instead of reading
+	bool csv;						// histogram as CSV without the summary
+} latencyCfg_t;
+
+/*
+*   @brief               Measure the latency of back-to-back accesses and print the
+*						 percentiles (min/median/p99/p99.9/max) and the histogram
+*	@param	reg			 mapped register
+*	@param	address		 physical address of the register (for the output)
+*	@param	cfg			 configuration
+*   @return              success
+*/
+bool runLatencyProbe(volatile uint32_t* reg, uint32_t address, const latencyCfg_t& cfg);
+
+#endif // LATENCY_PROBE_H
@@ -11,12 +11,24 @@
  * Change Log:  
  * 		1.00 (12-07-2019)
  * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		High-rate sampling mode into a timestamped ring buffer
+ * 		1.20 (10-16-2026)
+ * 		Watch list of multiple registers with change-only output
+ * 		1.30 (10-16-2026)
+ * 		Single reads over the rstoolsd daemon
+ * 		1.40 (10-16-2026)
+ * 		Symbolic register names with decoded fields
+ * 		1.50 (10-16-2026)
+ * 		Latency probe with percentiles and histogram
+ * 		1.60 (10-16-2026)
+ * 		Sampling and watch list over the rstoolsd daemon
  * 
  * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
  * 
  */
 
-#define VERSION "1.00"
+#define VERSION "1.60"
 
 #include <cstdio>
 #include <iostream>
@@ -28,29 +40,19 @@
 #include <thread>					// Required for putting task to sleep 
 #include <chrono>					// Required for putting task to sleep 
 #include <sstream>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_block.h"			// rstools block transfers
+#include "rstools_time.h"			// rstools timestamps and periodic waiting
+#include "rstools_regs.h"			// rstools register database
+#include "rstools_client.h"			// batch of reads over rstoolsd
+#include "latency_probe.h"			// latency of single accesses
 
 using namespace std;
 
-// Bridge Interfaces Base addresses 
-#define LWHPSFPGA_OFST  	0xff200000 // LWHPS2FPGA Bridge 
-#define HPSFPGA_OFST    	0xC0000000 // HPS2FPGA Bridge 
-#define MPU_OFSET			0x0        // MPU (HPS Address space)
-
-#define FPGAMAN_GPI_OFST    0xFF706014
-
-// Bridge interface End address 
-#define LWHPSFPGA_END   	0xFF3FFFFF
-#define HPSFPGA_END     	0xFBFFFFFF
-#define MPU_END         	0xFFFFFFFF
-
-// Bridge interface range (allowed input offset)
-#define LWH2F_RANGE    (LWHPSFPGA_END - LWHPSFPGA_OFST)
-#define H2F_RANGE      (HPSFPGA_END - HPSFPGA_OFST)
-#define MPU_RANGE      (MPU_END - MPU_OFSET)
-
-#define MAP_SIZE 4096UL
-#define MAP_MASK (MAP_SIZE - 1)
-
 // Auto refresh Mode settings
 #define REFRECHMODE_DELAY_MS	50
 #define REFRECHMODE_DURATION_MS 15000
@@ -82,6 +84,463 @@ bool checkIfInputIsVailed(std::string input, bool DecHex)
 	return false;
 }
 
+// High-rate sampling Mode settings
+#define SAMPLEMODE_DEFAULT_COUNT	10000		// Number of samples without "-n" and "-t"
+#define SAMPLEMODE_RING_SIZE		(1024*1024)	// Maximum number of buffered samples
+
+/*
+* Configuration of the high-rate sampling mode
+*/
+typedef struct
+{
+	uint64_t period_us;				// sampling period (0: as fast as possible)
+	uint64_t count;					// number of samples (0: use the duration)
+	uint64_t duration_ms;			// sampling duration (0: use the count)
+	std::string outFile;			// output file ("-": stdout)
+	bool binary;					// binary instead of CSV output
+} sampleCfg_t;
+
+/*
+* One timestamped sample (binary output format: 12 Byte, little endian)
+*/
+typedef struct __attribute__((packed))
+{
+	uint64_t time_ns;				// time since the first sample
+	uint32_t value;					// read register value
+} sample_t;
+
+static volatile sig_atomic_t sampleStop = 0;
+
+static void sampleSignalHandler(int)
+{
+	sampleStop = 1;
+}
+
+/*
+*	@brief  Read the arguments of the sampling mode
+*			-s <Period in us> [-n <Samples>] [-t <Duration in ms>] [-o <File|->] [-bin]
+*   @param  argc 		number of arguments
+*   @param  argv		arguments
+*   @param  first		index of the period argument
+*   @param  cfg			read configuration
+*	@return is Valid
+*/
+bool parseSampleArgs(int argc, const char* argv[], int first, sampleCfg_t* cfg)
+{
+	cfg->period_us = 0;
+	cfg->count = 0;
+	cfg->duration_ms = 0;
+	cfg->outFile = "-";
+	cfg->binary = false;
+
+	if ((argc <= first) || (!checkIfInputIsVailed(argv[first], true)))
+		return false;
+	cfg->period_us = strtoull(argv[first], nullptr, 10);
+
+	for (int i = first+1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-bin")
+		{
+			cfg->binary = true;
+			continue;
+		}
+		if (i+1 >= argc) return false;
+
+		if ((arg == "-n") && checkIfInputIsVailed(argv[i+1], true))
+			cfg->count = strtoull(argv[i+1], nullptr, 10);
+		else if ((arg == "-t") && checkIfInputIsVailed(argv[i+1], true))
+			cfg->duration_ms = strtoull(argv[i+1], nullptr, 10);
+		else if (arg == "-o")
+			cfg->outFile = argv[i+1];
+		else
+			return false;
+		i++;
+	}
+
+	if ((cfg->count == 0) && (cfg->duration_ms == 0))
+		cfg->count = SAMPLEMODE_DEFAULT_COUNT;
+
+	return true;
+}
+
+/*
+*	@brief  Sample a register with a fixed period into a ring buffer and
+*			write the timestamped values as CSV or binary on exit
+*			(end of the count or duration or Ctrl+C)
+*			If more samples were taken than the ring buffer holds,
+*			the latest SAMPLEMODE_RING_SIZE samples are written
+*   @param  reg 		mapped register (nullptr: read over rstoolsd)
+*   @param  address		physical address of the register
+*   @param  cfg			sampling configuration
+*	@return success
+*/
+bool runSampling(volatile uint32_t* reg, uint32_t address, const sampleCfg_t& cfg)
+{
+	bool toStdout = (cfg.outFile == "-");
+	ostream& info = toStdout ? cerr : cout;
+
+	// Size the ring buffer for the expected number of samples
+	uint64_t expected = cfg.count;
+	if (expected == 0)
+		expected = (cfg.period_us > 0) ? (cfg.duration_ms*1000/cfg.period_us + 1) : SAMPLEMODE_RING_SIZE;
+	size_t ringSize = (size_t) min<uint64_t>(expected, SAMPLEMODE_RING_SIZE);
+	vector<sample_t> ring(ringSize);
+
+	size_t head = 0;
+	uint64_t taken = 0;
+	uint64_t missed = 0;
+	uint64_t period_ns = cfg.period_us*1000;
+	uint64_t duration_ns = cfg.duration_ms*1000000;
+
+	sampleStop = 0;
+	signal(SIGINT, sampleSignalHandler);
+
+	uint64_t start = rsTimeNowNs();
+	uint64_t next = start;
+	while (!sampleStop)
+	{
+		uint64_t now = rsTimeNowNs();
+		if ((cfg.count > 0) && (taken >= cfg.count)) break;
+		if ((duration_ns > 0) && (now - start >= duration_ns)) break;
+
+		// Read the register and store it with the timestamp
+		uint32_t value;
+		if (reg != nullptr)
+			value = *reg;
+		else if (rsMemRead(address, &value) != RSMEM_SUCCESS)
+		{
+			info << "[ ERROR ] Reading the register over rstoolsd failed!" << endl;
+			break;
+		}
+		ring[head].time_ns = now - start;
+		ring[head].value   = value;
+		head = (head + 1 == ringSize) ? 0 : head + 1;
+		taken++;
+
+		if (period_ns > 0)
+		{
+			next += period_ns;
+			now = rsTimeNowNs();
+			// Skip the periods that were already missed
+			if (now >= next + period_ns)
+			{
+				uint64_t late = (now - next) / period_ns;
+				missed += late;
+				next   += late * period_ns;
+			}
+			rsTimeWaitUntilNs(next, &sampleStop);
+		}
+	}
+	uint64_t end = rsTimeNowNs();
+	signal(SIGINT, SIG_DFL);
+
+	// Write the buffered samples in the order of the time
+	size_t stored = (taken < ringSize) ? (size_t) taken : ringSize;
+	size_t first  = (taken < ringSize) ? 0 : head;
+
+	ofstream file;
+	if (!toStdout)
+	{
+		file.open(cfg.outFile, ios::out | ios::trunc | (cfg.binary ? ios::binary : ios::out));
+		if (!file.is_open())
+		{
+			cerr << "[ ERROR ] Failed to open the output file!" << endl;
+			return false;
+		}
+	}
+	ostream& out = toStdout ? cout : file;
+
+	if (cfg.binary)
+	{
+		if (first + stored > ringSize)
+		{
+			out.write((const char*) &ring[first], (ringSize - first) * sizeof(sample_t));
+			out.write((const char*) &ring[0], (first + stored - ringSize) * sizeof(sample_t));
+		}
+		else
+			out.write((const char*) &ring[first], stored * sizeof(sample_t));
+	}
+	else
+	{
+		char line[64];
+		std::string text;
+		text.reserve(RSBLOCK_CHUNK_SIZE);
+		out << "time_ns,value,hex" << "\n";
+		for (size_t i = 0; i < stored; i++)
+		{
+			const sample_t& s = ring[(first + i) % ringSize];
+			int len = snprintf(line, sizeof(line), "%llu,%u,0x%08x\n", \
+				(unsigned long long) s.time_ns, s.value, s.value);
+			text.append(line, len);
+			if (text.size() >= RSBLOCK_CHUNK_SIZE - sizeof(line))
+			{
+				out.write(text.data(), text.size());
+				text.clear();
+			}
+		}
+		out.write(text.data(), text.size());
+	}
+	out.flush();
+
+	double duration_s = (end - start) / 1e9;
+	info << "[ INFO ] " << taken << " samples in " << duration_s << " s";
+	if (duration_s > 0)
+		info << " (" << (uint64_t)(taken / duration_s) << " samples/s)";
+	info << endl;
+	if (missed > 0)
+		info << "[ WARNING ] " << missed << " sampling periods were missed" << endl;
+	if (taken > stored)
+		info << "[ WARNING ] Only the last " << stored << " samples were kept" << endl;
+
+	return true;
+}
+
+/*
+*	@brief  Read the arguments of the latency probe
+*			-l [<Accesses>] [-wr] [-csv]
+*   @param  argc 		number of arguments
+*   @param  argv		arguments
+*   @param  first		index of the first argument after "-l"
+*   @param  cfg			read configuration
+*	@return is Valid
+*/
+bool parseLatencyArgs(int argc, const char* argv[], int first, latencyCfg_t* cfg)
+{
+	cfg->count = LATENCY_DEFAULT_COUNT;
+	cfg->write = false;
+	cfg->csv = false;
+
+	for (int i = first; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-wr")
+			cfg->write = true;
+		else if (arg == "-csv")
+			cfg->csv = true;
+		else if ((i == first) && checkIfInputIsVailed(arg, true))
+			cfg->count = strtoull(argv[i], nullptr, 10);
+		else
+			return false;
+	}
+
+	return (cfg->count > 0) && (cfg->count <= LATENCY_MAX_COUNT);
+}
+
+// Watch Mode settings
+#define WATCHMODE_DEFAULT_PERIOD_US	1000		// Default tick of the watch list
+
+/*
+* One entry of the watch list
+*/
+typedef struct
+{
+	std::string name;				// entry as typed by the user
+	uint32_t address;				// physical address
+	uint32_t mask;					// bits to watch
+	volatile uint32_t* reg;			// mapped register (nullptr over rstoolsd)
+	uint32_t last;					// last masked value
+} watchEntry_t;
+
+/*
+*	@brief  Read a 32-bit HEX value (with or without "0x")
+*   @param  input 		String to read
+*   @param  value		read value
+*	@return is Valid
+*/
+bool parseHexValue(std::string input, uint32_t* value)
+{
+	if ((input.compare(0, 2, "0x") == 0) || (input.compare(0, 2, "0X") == 0))
+		input.erase(0, 2);
+	if ((input.length() < 1) || (input.length() > 8)) return false;
+	if (input.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) return false;
+
+	*value = strtoul(input.c_str(), nullptr, 16);
+	return true;
+}
+
+/*
+*	@brief  Read one entry of the watch list: <lw|hf|mpu|gpo|gpi>:<Offset in HEX>[:<Mask in HEX>]
+*			For gpo and gpi the offset is ignored and can be left empty (e.g. "gpi" or "gpi::1")
+*   @param  input 		entry to read
+*   @param  entry		read entry
+*	@return is Valid
+*/
+bool parseWatchEntry(const std::string& input, watchEntry_t* entry)
+{
+	std::string part[3];
+	uint8_t parts = 0;
+	size_t pos = 0;
+	while (parts < 3)
+	{
+		size_t end = input.find(':', pos);
+		part[parts++] = input.substr(pos, end - pos);
+		if (end == std::string::npos) break;
+		pos = end + 1;
+		if (parts == 3) return false;
+	}
+
+	uint32_t offset = 0;
+	entry->mask = 0xFFFFFFFF;
+	if ((parts > 1) && (part[1].length() > 0))
+	{
+		if (!parseHexValue(part[1], &offset)) return false;
+	}
+	if (parts > 2)
+	{
+		if (!parseHexValue(part[2], &entry->mask)) return false;
+	}
+
+	if (rsMemSpaceAddress(part[0].c_str(), offset, &entry->address) != RSMEM_SUCCESS)
+		return false;
+
+	entry->name = input;
+	entry->reg  = nullptr;
+	entry->last = 0;
+	return true;
+}
+
+/*
+*	@brief  Read the masked values of all entries of a watch list
+*			from the mapped registers or with one batch over rstoolsd
+*   @param  list 		watch list
+*   @param  ops			read operations of the batch (empty: mapped registers)
+*   @param  values		masked values
+*	@return success
+*/
+bool readWatchList(const vector<watchEntry_t>& list, vector<rsClientOp_t>& ops, vector<uint32_t>& values)
+{
+	if (ops.empty())
+	{
+		for (size_t i = 0; i < list.size(); i++)
+			values[i] = *list[i].reg & list[i].mask;
+		return true;
+	}
+
+	if (rsClientBatch(ops.data(), ops.size()) != RSMEM_SUCCESS) return false;
+	for (size_t i = 0; i < list.size(); i++)
+	{
+		if (ops[i].resp.status != RSMEM_SUCCESS) return false;
+		values[i] = ops[i].resp.value & list[i].mask;
+	}
+	return true;
+}
+
+/*
+*	@brief  Read all registers of a watch list every tick and print only
+*			the entries whose masked value changed (with a timestamp)
+*			until the duration is over or Ctrl+C was pressed
+*   @param  list 		watch list with mapped registers (or all over rstoolsd)
+*   @param  period_us	tick of the watch list
+*   @param  duration_ms	watch duration (0: until Ctrl+C)
+*/
+void runWatch(vector<watchEntry_t>& list, uint64_t period_us, uint64_t duration_ms)
+{
+	uint64_t period_ns = period_us*1000;
+	uint64_t duration_ns = duration_ms*1000000;
+	char line[128];
+	std::string text;
+
+	// Over rstoolsd the whole list is read with one batch per tick
+	vector<rsClientOp_t> ops;
+	if (rsMemIsRemote())
+	{
+		ops.resize(list.size());
+		for (size_t i = 0; i < list.size(); i++)
+		{
+			memset(&ops[i], 0, sizeof(rsClientOp_t));
+			ops[i].req.op = RSPROTO_OP_READ;
+			ops[i].req.address = list[i].address;
+		}
+	}
+	vector<uint32_t> values(list.size());
+
+	sampleStop = 0;
+	signal(SIGINT, sampleSignalHandler);
+
+	// Print the initial values
+	uint64_t start = rsTimeNowNs();
+	if (!readWatchList(list, ops, values))
+	{
+		cout << "[ ERROR ] Reading the watch list over rstoolsd failed!" << endl;
+		signal(SIGINT, SIG_DFL);
+		return;
+	}
+	for (size_t i = 0; i < list.size(); i++)
+	{
+		list[i].last = values[i];
+		int len = snprintf(line, sizeof(line), "%12.6f  %-20s 0x%08x\n", 0.0, list[i].name.c_str(), list[i].last);
+		text.append(line, len);
+	}
+	cout.write(text.data(), text.size());
+	cout.flush();
+
+	uint64_t next = start;
+	while (!sampleStop)
+	{
+		next += period_ns;
+		uint64_t now = rsTimeWaitUntilNs(next, &sampleStop);
+		if (sampleStop || ((duration_ns > 0) && (now - start >= duration_ns))) break;
+
+		// Read all entries first, so that they are sampled as close as possible
+		if (!readWatchList(list, ops, values))
+		{
+			cout << "[ ERROR ] Reading the watch list over rstoolsd failed!" << endl;
+			break;
+		}
+		text.clear();
+		for (size_t i = 0; i < list.size(); i++)
+		{
+			uint32_t value = values[i];
+			if (value != list[i].last)
+			{
+				int len = snprintf(line, sizeof(line), "%12.6f  %-20s 0x%08x -> 0x%08x\n", \
+					(now - start) / 1e9, list[i].name.c_str(), list[i].last, value);
+				text.append(line, len);
+				list[i].last = value;
+			}
+		}
+		if (text.size() > 0)
+		{
+			cout.write(text.data(), text.size());
+			cout.flush();
+		}
+
+		// Do not try to catch up missed ticks
+		if (rsTimeNowNs() > next + period_ns)
+			next = rsTimeNowNs();
+	}
+	signal(SIGINT, SIG_DFL);
+}
+
+/*
+*	@brief  Print the fields of a register value of the register database
+*   @param  reg 		register
+*   @param  field		selected field or nullptr for all fields
+*   @param  value		read register value
+*/
+void printRegFields(const rsReg_t* reg, const rsRegField_t* field, uint32_t value)
+{
+	char line[128];
+	for (uint8_t i = 0; i < reg->fieldCount; i++)
+	{
+		const rsRegField_t* f = &reg->fields[i];
+		if ((field != nullptr) && (f != field)) continue;
+
+		char bits[16];
+		if (f->width == 1)
+			snprintf(bits, sizeof(bits), "[%u]", f->lsb);
+		else
+			snprintf(bits, sizeof(bits), "[%u:%u]", f->lsb + f->width - 1, f->lsb);
+
+		uint32_t fieldValue = rsRegFieldGet(f, value);
+		const char* enumName = rsRegEnumName(f, fieldValue);
+		snprintf(line, sizeof(line), "   %-18s %-8s = %u [0x%x]%s%s", f->name, bits, \
+			fieldValue, fieldValue, (enumName != nullptr) ? "  " : "", (enumName != nullptr) ? enumName : "");
+		cout << line << endl;
+	}
+}
+
 int main(int argc, const char* argv[])
 {
 	// Read a Register of the light Lightweight or AXI HPS to FPGA Interface
@@ -127,6 +586,26 @@ int main(int argc, const char* argv[])
 		if ((argc > (3-arg_no)) && (std::string(argv[3-arg_no]) == "-r"))
 			refreshMode = true;
 
+		// Check if the high-rate sampling mode was enabled
+		bool samplingMode = false;
+		sampleCfg_t sampleCfg;
+		if ((argc > (3-arg_no)) && (std::string(argv[3-arg_no]) == "-s"))
+		{
+			samplingMode = true;
+			if (!parseSampleArgs(argc, argv, 4-arg_no, &sampleCfg))
+				InputVailed = false;
+		}
+
+		// Check if the latency probe was enabled
+		bool latencyMode = false;
+		latencyCfg_t latencyCfg;
+		if ((argc > (3-arg_no)) && (std::string(argv[3-arg_no]) == "-l"))
+		{
+			latencyMode = true;
+			if (!parseLatencyArgs(argc, argv, 4-arg_no, &latencyCfg))
+				InputVailed = false;
+		}
+
 		// For GPI reading do not process input address offset
 		if(!gpi_read_mode)
 		{
@@ -203,7 +682,7 @@ int main(int argc, const char* argv[])
 		// only in case the input is valid read the bridge
 		if (InputVailed)
 		{
-			if (ConsloeOutput)
+			if (ConsloeOutput && !samplingMode && !latencyMode)
 			{	
 				cout << "------------------------------------READING------------------------------------------" << endl;
 				if (address_space < 2)
@@ -229,14 +708,8 @@ int main(int argc, const char* argv[])
 			}
 			do
 			{
-				void* bridgeMap;
-				int fd;
-
 				// open memory driver 
-				fd = open("/dev/mem", (O_RDWR | O_SYNC));
-
-				// was opening okay
-				if (fd < 0)
+				if (rsMemOpen() != RSMEM_SUCCESS)
 				{
 					if (ConsloeOutput)
 						cout << "ERROR: Failed to open memory driver!" << endl;
@@ -245,24 +718,61 @@ int main(int argc, const char* argv[])
 					break;
 				}
 
-				bridgeMap = mmap(NULL, 4, PROT_READ, MAP_PRIVATE, fd, \
-						address & ~MAP_MASK);
-				// check if opening was successfully
-				if (bridgeMap == MAP_FAILED)
+				// Over rstoolsd every sample is a read request of the daemon
+				if (samplingMode && rsMemIsRemote())
+				{
+					runSampling(nullptr, address, sampleCfg);
+					rsMemClose();
+					break;
+				}
+
+				// The probe measures the bus access, over rstoolsd it would measure the socket
+				if (latencyMode && rsMemIsRemote())
 				{
 					if (ConsloeOutput)
-						cout << "ERROR: Accessing the virtual memory failed!" << endl;
+						cout << "[ ERROR ] The latency probe needs direct access to the memory driver (unset " \
+							 << RSPROTO_ENV_SOCKET << ")!" << endl;
 					else
 						cout << -2;
-					close(fd);
+					rsMemClose();
+					break;
+				}
+
+				if (samplingMode || latencyMode)
+				{
+					// The sampling loop and the latency probe access the mapped register directly
+					volatile uint32_t* readMap = rsMemMap(address, 4);
+					// check if opening was successfully
+					if (readMap == nullptr)
+					{
+						if (ConsloeOutput)
+							cout << "ERROR: Accessing the virtual memory failed!" << endl;
+						else
+							cout << -2;
+						rsMemClose();
+						break;
+					}
+					if (samplingMode)
+						runSampling(readMap, address, sampleCfg);
+					else
+						runLatencyProbe(readMap, address, latencyCfg);
+					rsMemClose();
 					break;
 				}
-				void* readMap = bridgeMap + (address & MAP_MASK);
+
 				uint16_t delay_count = 0;
 				do
 				{
-					// Read the address 
-					uint32_t value = *((uint32_t*)readMap);
+					// Read the address (over the cached window or rstoolsd)
+					uint32_t value;
+					if (rsMemRead(address, &value) != RSMEM_SUCCESS)
+					{
+						if (ConsloeOutput)
+							cout << "ERROR: Accessing the virtual memory failed!" << endl;
+						else
+							cout << -2;
+						break;
+					}
 
 					if (ConsloeOutput)
 					{
@@ -323,16 +833,8 @@ int main(int argc, const char* argv[])
 
 				} while (delay_count<REFRECHMODE_MAX_COUNT);
 
-				// Close the MAP 
-				if (munmap(bridgeMap, 4) < 0)
-				{
-					if (ConsloeOutput)
-						cout << "[ ERROR ] Closing of shared memory failed!" << endl;
-				}
-
-				// Close the driver port 
-				close(fd);
-
+				// Close the MAP and the driver port 
+				rsMemClose();
 
 			} while (0);
 		}
@@ -345,8 +847,147 @@ int main(int argc, const char* argv[])
 			{
 				cout << "[ ERROR ] User Input is wrong!"<<endl;
 				cout <<	"          FPGA-readBridge -lw|hf|mpu|gpi <Address Offset in HEX> -b|r"<< endl;
+				cout <<	"          FPGA-readBridge -lw|hf|mpu|gpi <Address Offset in HEX> -s <Period in us> [-n <Samples>]"<< endl;
+				cout <<	"                          [-t <Duration in ms>] [-o <File|->] [-bin]"<< endl;
+				cout <<	"          FPGA-readBridge -lw|hf|mpu|gpi <Address Offset in HEX> -l [<Accesses>] [-wr] [-csv]"<< endl;
+			}
+		}
+	}
+	// Watch a list of registers
+	else if ((argc > 2) && (std::string(argv[1]) == "-w"))
+	{
+		vector<watchEntry_t> list;
+		uint64_t period_us = WATCHMODE_DEFAULT_PERIOD_US;
+		uint64_t duration_ms = 0;
+		bool InputVailed = true;
+
+		for (int i = 2; (i < argc) && InputVailed; i++)
+		{
+			std::string arg = argv[i];
+			if ((arg == "-p") || (arg == "-t"))
+			{
+				if ((i+1 >= argc) || (!checkIfInputIsVailed(argv[i+1], true)))
+				{
+					InputVailed = false;
+					break;
+				}
+				uint64_t value = strtoull(argv[++i], nullptr, 10);
+				if (arg == "-p")
+					period_us = value;
+				else
+					duration_ms = value;
+			}
+			else
+			{
+				watchEntry_t entry;
+				if (parseWatchEntry(arg, &entry))
+					list.push_back(entry);
+				else
+				{
+					cout << "[ ERROR ] Watch entry \"" << arg << "\" is not valid!" << endl;
+					InputVailed = false;
+				}
 			}
 		}
+		if (list.size() == 0) InputVailed = false;
+
+		do
+		{
+			if (!InputVailed)
+			{
+				cout << "[ ERROR ] User Input is wrong!"<<endl;
+				cout <<	"          FPGA-readBridge -w <lw|hf|mpu|gpo|gpi>:<Offset in HEX>[:<Mask in HEX>] ..."<< endl;
+				cout <<	"                          [-p <Period in us>] [-t <Duration in ms>]"<< endl;
+				break;
+			}
+
+			// open memory driver 
+			if (rsMemOpen() != RSMEM_SUCCESS)
+			{
+				cout << "ERROR: Failed to open memory driver!" << endl;
+				break;
+			}
+
+			// Map all entries once (entries of the same page share a window)
+			bool mapped = true;
+			for (size_t i = 0; (i < list.size()) && !rsMemIsRemote(); i++)
+			{
+				list[i].reg = rsMemMap(list[i].address, 4);
+				if (list[i].reg == nullptr) mapped = false;
+			}
+			if (!mapped)
+			{
+				cout << "ERROR: Accessing the virtual memory failed!" << endl;
+				rsMemClose();
+				break;
+			}
+
+			runWatch(list, period_us, duration_ms);
+
+			// Close the MAP and the driver port 
+			rsMemClose();
+
+		} while (0);
+	}
+	// Read a register of the register database by its name
+	else if ((argc > 2) && (std::string(argv[1]) == "-reg"))
+	{
+		bool ConsloeOutput = !((argc > 3) && (std::string(argv[3]) == "-b"));
+
+		// List all registers
+		if (std::string(argv[2]) == "list")
+		{
+			for (size_t i = 0; i < rsRegCount(); i++)
+			{
+				const rsReg_t* reg = rsRegAt(i);
+				cout << "   0x" << hex << reg->address << dec << "  " << reg->name << endl;
+			}
+			return 0;
+		}
+
+		const rsReg_t* reg;
+		const rsRegField_t* field;
+		if (rsRegParse(argv[2], &reg, &field) != RSMEM_SUCCESS)
+		{
+			if (ConsloeOutput)
+			{
+				cout << "[ ERROR ] \"" << argv[2] << "\" is not a register of the database!" << endl;
+				cout << "          FPGA-readBridge -reg <Register>[.<Field>] -b" << endl;
+				cout << "          FPGA-readBridge -reg list" << endl;
+			}
+			else
+				cout << -1;
+			return 0;
+		}
+
+		uint32_t value = 0;
+		int res = rsMemOpen();
+		if (res == RSMEM_SUCCESS)
+			res = rsMemRead(reg->address, &value);
+		rsMemClose();
+
+		if (res != RSMEM_SUCCESS)
+		{
+			if (ConsloeOutput)
+				cout << "ERROR: Accessing the virtual memory failed!" << endl;
+			else
+				cout << -2;
+		}
+		else if (!ConsloeOutput)
+		{
+			// output only the value of the register or of the field as decimal
+			cout << ((field != nullptr) ? rsRegFieldGet(field, value) : value);
+		}
+		else
+		{
+			cout << "------------------------------------READING------------------------------------------" << endl;
+			cout << "   Register:    " << reg->name << "      Address:     0x" << hex << reg->address << dec << endl;
+			cout << "-------------------------------------------------------------------------------------" << endl;
+			cout << "			      Value: " << value << " [0x" << hex << value << "]" << dec << endl;
+			cout << "-------------------------------------------------------------------------------------" << endl;
+			printRegFields(reg, field, value);
+			cout << "-------------------------------------------------------------------------------------" << endl;
+		}
 	}
 	else
 	{
@@ -374,6 +1015,33 @@ int main(int argc, const char* argv[])
 		cout << "|                     L -2 = Linux Kernel Memory Error                                       |" << endl;
 		cout << "|      Suffix: -r -> Auto refrech the value for 15sec                                        |" << endl;
 		cout << "|$ FPGA-readBridge -lw|hf|mpu|gpi <Address Offset in HEX> -b|r                               |" << endl;
+		cout << "|                                                                                            |" << endl;
+		cout << "|      Suffix: -s -> High-rate sampling into a timestamped ring buffer                       |" << endl;
+		cout << "|$ FPGA-readBridge -lw|hf|mpu|gpi <Address Offset in HEX> -s <Period in us>                  |" << endl;
+		cout << "|                  [-n <Samples>] [-t <Duration in ms>] [-o <File|->] [-bin]                 |" << endl;
+		cout << "|      L   Output on exit (or Ctrl+C) as CSV \"time_ns,value,hex\" or with -bin as             |" << endl;
+		cout << "|          12 Byte records (uint64_t time in ns, uint32_t value), default: 10000 samples     |" << endl;
+		cout << "|          e.g.: FPGA-readBridge -gpi -s 10 -t 2000 -o gpi.csv                               |" << endl;
+		cout << "|                                                                                            |" << endl;
+		cout << "|      Suffix: -l -> Latency probe of back-to-back accesses (CLOCK_MONOTONIC_RAW)            |" << endl;
+		cout << "|$ FPGA-readBridge -lw|hf|mpu|gpi <Address Offset in HEX> -l [<Accesses>] [-wr] [-csv]       |" << endl;
+		cout << "|      L   Prints min/median/mean/p99/p99.9/max and a log-linear histogram in ns             |" << endl;
+		cout << "|          -wr writes the current value back instead of reading, default: 100000 reads       |" << endl;
+		cout << "|          -csv prints only the histogram \"from_ns,to_ns,count,cumulative\"                   |" << endl;
+		cout << "|          e.g.: FPGA-readBridge -lw 100 -l 1000000                                          |" << endl;
+		cout << "|                                                                                            |" << endl;
+		cout << "|$ FPGA-readBridge -w <lw|hf|mpu|gpo|gpi>:<Offset in HEX>[:<Mask in HEX>] ...                |" << endl;
+		cout << "|                  [-p <Period in us>] [-t <Duration in ms>]                                 |" << endl;
+		cout << "|      L   Watch a list of registers, print only changes of the masked values                |" << endl;
+		cout << "|          Default period: 1000 us, runs until Ctrl+C without -t                             |" << endl;
+		cout << "|          e.g.: FPGA-readBridge -w gpi lw:10:ff00 hf:100:1 -p 100                           |" << endl;
+		cout << "|                                                                                            |" << endl;
+		cout << "|$ FPGA-readBridge -reg <Register>[.<Field>] -b                                              |" << endl;
+		cout << "|      L   Read a HPS register by its name (hps.h without \"ALT_\") and decode the fields      |" << endl;
+		cout << "|          With -b only the value of the register or of the field is printed in DEC          |" << endl;
+		cout << "|          e.g.: FPGA-readBridge -reg FPGAMGR_STAT.MODE                                      |" << endl;
+		cout << "|$ FPGA-readBridge -reg list                                                                 |" << endl;
+		cout << "|      L   List all registers of the register database                                       |" << endl;
 		cout << "----------------------------------------------------------------------------------------------" << endl;
 		cout << "| Vers.: "<<VERSION<<"                                                                                |"<<endl;
 		cout << "| Copyright (C) 2021-2022 rsyocto GmbH & Co. KG                                              |" << endl;
@@ -10,12 +10,14 @@
  * Change Log:  
  * 		1.00 (03-08-2022)
  * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Register access over the rstoolsd daemon
  * 
  * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
  * 
  */
 
-#define VERSION "1.00"
+#define VERSION "1.10"
 
 
 #include <iostream>
@@ -26,6 +28,7 @@
 #include <cstdint>                  // Standard integral types (uint8_t,...)
 #include <thread>					// Required for putting task to sleep 
 #include <chrono>					// Required for putting task to sleep 
+#include "rstools_mem.h"			// rstools shared register access layer
 
 
 using namespace std;
@@ -43,13 +46,11 @@ using namespace std;
 
 #define REG_FPGAMG_CTL_EN			(1<<0)
 #define REG_FPGAMG_CTL_nCONFIG		(1<<2)
-/*
-* Global Values
-*/
 
-volatile int posix_fd;
-volatile void* fpgaMangerMap;    	// Memory Map assigned to FPGA Manger
-volatile uint32_t* ptrFpgaManger;   // Pointer to FPGA Manager Registers 
+// Reset Manager Bridge Module Reset Register (HPS2FPGA, LWHPS2FPGA, FPGA2HPS)
+#define REG_RSTMGR_BRGMODRST		0xFFD0501C
+// Reset Manager Miscellaneous Module Reset Register (h2f_rst_n, h2f_cold_rst_n)
+#define REG_RSTMGR_MISCMODRST		0xFFD05020
 
 /*
 *   @brief               Convert FPGA State Code to String with state description 
@@ -86,10 +87,10 @@ string state2str(uint8_t state_code)
 */ 
 uint8_t readState(void)
 {	
-	if (ptrFpgaManger==0) return 0xFF;
 	// Read Bit 0-3 of the FPGA Manager Status register
-	uint32_t stat = *(ptrFpgaManger + (REG_FPGAMG_STATUS_OFFSET)) & 0x7;
-	return (uint8_t) stat;
+	uint32_t stat;
+	if (rsMemRead(REG_FPGAMG_STATUS, &stat) != RSMEM_SUCCESS) return 0xFF;
+	return (uint8_t) (stat & 0x7);
 }
 
 
@@ -105,17 +106,24 @@ bool performFPGAfabricClear(bool ConsloeOutput)
 		cout <<"#    Performing FPGA Fabric Reset"<<endl;
 
 	// Enable HPS access to FPGA Manager mode
-	system("FPGA-writeBridge -mpu 0xFF706004 -b 0 1 -b");
+	if (rsMemSetBits(REG_FPGAMG_CTL, REG_FPGAMG_CTL_EN) != RSMEM_SUCCESS)
+	{
+		if(ConsloeOutput)
+			cout << "[ERROR] Failed to access the FPGA Manager Control Register"<<endl;
+		else
+			cout << "-2";
+		return false;
+	}
 	
 	// Reset the FPGA Fabric by Setting nCONFIG = High
 	if(ConsloeOutput)
         cout << "[INFO] Pull-down nCONFIG input to the CB. This puts the FPGA in reset phase and restarts configuration."<<endl;
 
-	// Enable HPS access to FPGA Manager mode
-	system("FPGA-writeBridge -mpu 0xFF706004 -b 2 1 -b");
+	// Pull nCONFIG of the FPGA Manager
+	rsMemSetBits(REG_FPGAMG_CTL, REG_FPGAMG_CTL_nCONFIG);
 
 	// Leave the HPS access to FPGA Manager mode
-	system("FPGA-writeBridge -mpu 0xFF706004 -b 0 0 -b");
+	rsMemClearBits(REG_FPGAMG_CTL, REG_FPGAMG_CTL_EN);
 
 	// Check that the FPGA Fabric is in Reset State
 	if(!readState()==0x01)
@@ -163,15 +171,28 @@ bool performHPStoFPGAReset(bool ConsloeOutput, uint8_t reset_typ)
 		}
 	}
 
-	// RESET =1 
+	// Select the Reset Manager register and bit of the reset
+	uint32_t reg =0;
+	uint32_t bit =0;
 
 	// Peform Cold or Warm FPGA Reset
-	if(reset_typ ==1) 		system("FPGA-writeBridge -mpu 0xFFD05020 -b 6 1 -b");
-	else if(reset_typ ==2) system("FPGA-writeBridge -mpu 0xFFD05020 -b 7 1 -b");
+	if(reset_typ ==1) 		{ reg = REG_RSTMGR_MISCMODRST; bit = (1<<6); }
+	else if(reset_typ ==2)	{ reg = REG_RSTMGR_MISCMODRST; bit = (1<<7); }
 	// Peform a Bridge Reset
-	else if(reset_typ==3)	system("FPGA-writeBridge -mpu 0xFFD0501C -b 1 1 -b");
-	else if(reset_typ==4)	system("FPGA-writeBridge -mpu 0xFFD0501C -b 0 1 -b");
-	else if(reset_typ==5)	system("FPGA-writeBridge -mpu 0xFFD0501C -b 2 1 -b");
+	else if(reset_typ==3)	{ reg = REG_RSTMGR_BRGMODRST;  bit = (1<<1); }
+	else if(reset_typ==4)	{ reg = REG_RSTMGR_BRGMODRST;  bit = (1<<0); }
+	else if(reset_typ==5)	{ reg = REG_RSTMGR_BRGMODRST;  bit = (1<<2); }
+	else return false;
+
+	// RESET =1 
+	if (rsMemSetBits(reg, bit) != RSMEM_SUCCESS)
+	{
+		if(ConsloeOutput)
+			cout << "[ERROR] Failed to access the Reset Manager"<<endl;
+		else
+			cout << "-2";
+		return false;
+	}
 
 	// Wait 50ms
 	// C++11: Put this task to sleep 
@@ -179,14 +200,7 @@ bool performHPStoFPGAReset(bool ConsloeOutput, uint8_t reset_typ)
 		std::chrono::milliseconds(50));
 
 	// RESET =0
-
-	// Peform Cold or Warm FPGA Reset
-	if(reset_typ ==1) 		system("FPGA-writeBridge -mpu 0xFFD05020 -b 6 0 -b");
-	else if(reset_typ ==2) system("FPGA-writeBridge -mpu 0xFFD05020 -b 7 0 -b");
-	// Peform a Bridge Reset
-	else if(reset_typ==3)	system("FPGA-writeBridge -mpu 0xFFD0501C -b 1 0 -b");
-	else if(reset_typ==4)	system("FPGA-writeBridge -mpu 0xFFD0501C -b 0 0 -b");
-	else if(reset_typ==5)	system("FPGA-writeBridge -mpu 0xFFD0501C -b 2 0 -b");
+	rsMemClearBits(reg, bit);
 
 	if(ConsloeOutput)
 		cout << "[SUCCESS] Reset performed"<<endl;
@@ -199,45 +213,26 @@ bool performHPStoFPGAReset(bool ConsloeOutput, uint8_t reset_typ)
 
 
 /*
-*   @brief                Inititalisation of HPS Register Maps 
-*						  FPGA Manager Status Register: 0xFF706000 - 0xFF706004
+*   @brief                Open the memory driver or the connection to rstoolsd
 *   @return               success  
 */ 
 int initMemRegs(void)
 {
 	// Open Linux Memory Driver port
-	posix_fd = open("/dev/mem", (O_RDWR | O_SYNC));
-
     // Check that the opening was sucsessfull 
-	if (posix_fd < 0)
+	if (rsMemOpen() != RSMEM_SUCCESS)
 	{
 		cout << "[ERROR]  Failed to read the memory driver!" << endl;
 		return -1;
 	}
 
-	//
-	// FPGA Manager Address Space
-	//
-
-    // Create a Memory Map to acess the FPGA Manger
-	fpgaMangerMap = mmap(NULL, 4, PROT_READ, MAP_PRIVATE, posix_fd, \
-		REG_FPGAMG_STATUS);
-
-    if (fpgaMangerMap == MAP_FAILED)
+	// The FPGA Manager Registers are accessed with rsMemRead/rsMemSetBits
+	if (readState() == 0xFF)
 	{
 		cout << "\n[ERROR] Failed to open the memory maped interface to the FPGA Manger" << endl;
         return -1;
 	}
 
-    // Allocate a pointer to the maped address space 
-    ptrFpgaManger = (uint32_t*)fpgaMangerMap;
-
-    if (ptrFpgaManger==0) 
-    {
-        cout << "\n[ERROR] Failed to allocate a ponter to the FPGA Manager Address Space"<<endl;
-        return -1;
-    }
-
     return 1;
 }
 
@@ -247,14 +242,8 @@ int initMemRegs(void)
 */
 void deinit(void)
 {
-    // Close the MMAP for the FPGA Manager Address Space
-    if (fpgaMangerMap != MAP_FAILED)
-    {
-        munmap((void*) fpgaMangerMap, 4);
-    }
-
-    // close POSIX port
-    close(posix_fd);
+    // Close all MMAPs and the POSIX port
+	rsMemClose();
 }
 
 
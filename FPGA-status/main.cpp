@@ -11,77 +11,32 @@
  * Change Log:  
  * 		1.00 (03-03-2022)
  * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Single pass snapshot of the registers with JSON and raw output
+ * 		1.20 (10-16-2026)
+ * 		Continuous monitor mode with Prometheus textfile and HTTP export
  * 
  * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
  * 
  */
 
-#define VERSION "1.00"
+#define VERSION "1.20"
 
 
 #include <iostream>
+#include <cstdlib>
 #include <fstream>					// POSIX: for acessing Linux drivers
 #include <sys/mman.h>				// POSIX: memory maping
 #include <fcntl.h>					// POSIX: "PROT_WRITE", "MAP_SHARED", ...
 #include <unistd.h>					// POSIX: for closing the Linux driver access
 #include <cstdint>                  // Standard integral types (uint8_t,...)
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "status_snapshot.h"		// snapshot of the status registers
+#include "status_monitor.h"			// continuous monitor
 
 
 using namespace std;
 
-/*
-*
-* Registers
-*/
-
-// FPGA Manager Status Register (MSEL, Status)
-#define REG_FPGAMG_STATUS			0xFF706000
-#define REG_FPGAMG_STATUS_OFFSET	0x0
-
-// System Mangaer bootinfo Register
-#define REG_SYSMAN_BASE				0xFFD08000
-#define REG_SYSMAN_SILID_OFFSET		0x00
-#define REG_SYSMAN_BOOTINFO			0xFFD08014
-#define REG_SYSMAN_BOOTINFO_OFFSET	0x14
-#define REG_SYSMAN_HPSINFO			0xFFD08018
-#define REG_SYSMAN_HPSINFO_OFFSET	0x18
-#define REG_SYSMAN_GBL				0xFFD08020
-#define REG_SYSMAN_GBL_OFFSET		0x20
-#define REG_SYSMAN_INDIV			0xFFD08024
-#define REG_SYSMAN_INDIV_OFFSET		0x24
-#define REG_SYSMAN_MODULE			0xFFD08028
-#define REG_SYSMAN_MODULE_OFFSET	0x28
-
-
-#define REG_WDT0_BASE				0xFFD02000
-#define REG_WDT0_OFFFSET			0x00
-
-#define REG_WDT1_BASE				0xFFD03000
-#define REG_WDT1_OFFFSET			0x00
-
-
-#define REG_CLCK_CTRL				0xFFD04000
-#define REG_CLCK_CTRL_OFFFSET		0x00
-/*
-* Global Values
-*/
-
-volatile int posix_fd;
-volatile void* fpgaMangerMap;    	// Memory Map assigned to FPGA Manger
-volatile uint32_t* ptrFpgaManger;   // Pointer to FPGA Manager Registers 
-
-volatile void* systemMangerMap;    	// Memory Map assigned to System Manager
-volatile uint32_t* ptrsystemManger; // Pointer to the System Manager
-
-volatile void* wdt0Map;    			
-volatile uint32_t* ptrwdt0; 
-
-volatile void* wdt1Map;    			
-volatile uint32_t* ptrwdt1;
-
-volatile void* clkmgrMap;    			
-volatile uint32_t* ptrclkmgr;
-
 /*
 *   @brief               Convert MSEL Code to String with mode description 
 *   @param	msel_code	 MSEL Code (acording datasheet)
@@ -304,407 +259,152 @@ string clockCtrl2str(uint8_t regitser)
 	return msg;	
 }
 
-/*
-*   @brief                Inititalisation of HPS Register Maps 
-*						  FPGA Manager Status Register: 0xFF706000 - 0xFF706004
-*   @return               success  
-*/ 
-int initMemRegs(void)
+int main(int argc, const char* argv[])
 {
-	// Open Linux Memory Driver port
-	posix_fd = open("/dev/mem", (O_RDWR | O_SYNC));
-
-    // Check that the opening was sucsessfull 
-	if (posix_fd < 0)
-	{
-		cout << "[ERROR]  Failed to read the memory driver!" << endl;
-		return -1;
-	}
-
-	//
-	// FPGA Manager Address Space
-	//
-
-    // Create a Memory Map to acess the FPGA Manger
-	fpgaMangerMap = mmap(NULL, 4, PROT_READ, MAP_PRIVATE, posix_fd, \
-		REG_FPGAMG_STATUS);
-
-    if (fpgaMangerMap == MAP_FAILED)
+	bool jsonMode = false;
+	bool rawMode = false;
+	for (int i = 1; i < argc; i++)
 	{
-		cout << "\n[ERROR] Failed to open the memory maped interface to the FPGA Manger" << endl;
-        return -1;
+		std::string arg = argv[i];
+		if ((arg == "--json") || (arg == "-json")) jsonMode = true;
+		if ((arg == "--raw") || (arg == "-raw")) rawMode = true;
 	}
 
-    // Allocate a pointer to the maped address space 
-    ptrFpgaManger = (uint32_t*)fpgaMangerMap;
-
-    if (ptrFpgaManger==0) 
-    {
-        cout << "\n[ERROR] Failed to allocate a ponter to the FPGA Manager Address Space"<<endl;
-        return -1;
-    }
-
-	
-	//
-	// System Manger Address Space
-	//
-
-    // Create a Memory Map to acess the System Manger
-	systemMangerMap = mmap(NULL,REG_SYSMAN_MODULE_OFFSET+4, PROT_READ, MAP_PRIVATE, posix_fd, \
-		REG_SYSMAN_BASE);
-
-    if (systemMangerMap == MAP_FAILED)
-	{
-		cout << "\n[ERROR] Failed to open the memory maped interface to the System Manager" << endl;
-        return -1;
-	}
-
-    // Allocate a pointer to the maped address space 
-    ptrsystemManger = (uint32_t*)systemMangerMap;
-
-    if (ptrsystemManger==0) 
-    {
-        cout << "\n[ERROR] Failed to allocate a ponter to the to the System Manager Address Space"<<endl;
-        return -1;
-    }
-	
-	//
-	// WatchDog 0 Address Space
-	//
-
-    // Create a Memory Map
-	wdt0Map = mmap(NULL,4, PROT_READ, MAP_PRIVATE, posix_fd, \
-		REG_WDT0_BASE);
-
-    if (wdt0Map == MAP_FAILED)
-	{
-		cout << "\n[ERROR] Failed to open the memory maped interface to the WatchDog 0" << endl;
-        return -1;
-	}
-
-    // Allocate a pointer to the maped address space 
-    ptrwdt0 = (uint32_t*)wdt0Map;
-
-    if (ptrwdt0==0) 
-    {
-        cout << "\n[ERROR] Failed to allocate a ponter to the to the WatchDog 0"<<endl;
-        return -1;
-    }
-	
-	//
-	// WatchDog 1 Address Space
-	//
-
-    // Create a Memory Map
-	wdt1Map = mmap(NULL,4, PROT_READ, MAP_PRIVATE, posix_fd, \
-		REG_WDT1_BASE);
-
-    if (wdt1Map == MAP_FAILED)
+	if ((argc > 1) && (std::string(argv[1]) == "-h"))
 	{
-		cout << "\n[ERROR] Failed to open the memory maped interface to the WatchDog 1" << endl;
-        return -1;
+		cout << "	Command to read current Status of the HPS and FPGA Fabric" << endl;
+		cout << "	FPGA-status" << endl;
+		cout << "		Read the status with detailed output" << endl;
+		cout << "	FPGA-status --json" << endl;
+		cout << "		Read the status as single line JSON object (decoded values and registers)" << endl;
+		cout << "	FPGA-status --raw" << endl;
+		cout << "		Write the captured registers as binary record (" << sizeof(statusSnapshot_t) << " Bytes) to stdout" << endl;
+		cout << "	FPGA-status -monitor {-interval [ms]} {-textfile [path]} {-port [port]} {-count [samples]}" << endl;
+		cout << "		Sample the status every interval (default: " << STATUS_MONITOR_INTERVAL_MS << " ms) and export" << endl;
+		cout << "		the metrics to a Prometheus node_exporter textfile (*.prom, replaced atomically)" << endl;
+		cout << "		and/or over HTTP on 127.0.0.1:[port] until SIGINT/SIGTERM" << endl;
+		cout << "		e.g.: FPGA-status -monitor -interval 2000 -textfile /var/lib/node_exporter/fpga.prom" << endl;
+		cout <<endl <<"Vers.: "<<VERSION<<endl;
+		cout <<"Copyright (C) 2020-2022 rsyocto GmbH & Co. KG" << endl;
+		return 0;
 	}
 
-    // Allocate a pointer to the maped address space 
-    ptrwdt1 = (uint32_t*)wdt1Map;
-
-    if (ptrwdt1==0) 
-    {
-        cout << "\n[ERROR] Failed to allocate a ponter to the to the WatchDog 1"<<endl;
-        return -1;
-    }
-
-
-	//
-	// Clock Manager Address Space
-	//
-
-    // Create a Memory Map
-	clkmgrMap = mmap(NULL,4, PROT_READ, MAP_PRIVATE, posix_fd, \
-		REG_CLCK_CTRL);
-
-    if (clkmgrMap == MAP_FAILED)
+	// Continuous monitor with Prometheus export
+	if ((argc > 1) && (std::string(argv[1]) == "-monitor"))
 	{
-		cout << "\n[ERROR] Failed to open the memory maped interface to the Clock Manager" << endl;
-        return -1;
+		statusMonitorCfg_t cfg;
+		cfg.interval_ms = STATUS_MONITOR_INTERVAL_MS;
+		cfg.port = 0;
+		cfg.count = 0;
+		bool InputVailed = true;
+		for (int i = 2; i < argc; i++)
+		{
+			std::string arg = argv[i];
+			if (i + 1 >= argc) InputVailed = false;
+			else if (arg == "-interval") cfg.interval_ms = strtoul(argv[++i], nullptr, 10);
+			else if (arg == "-textfile") cfg.textFile = argv[++i];
+			else if (arg == "-port") cfg.port = strtoul(argv[++i], nullptr, 10);
+			else if (arg == "-count") cfg.count = strtoull(argv[++i], nullptr, 10);
+			else InputVailed = false;
+		}
+
+		if (!InputVailed || (cfg.interval_ms < STATUS_MONITOR_INTERVAL_MIN_MS) || (cfg.textFile.empty() && (cfg.port == 0)))
+		{
+			cout << "[ERROR]  Use: FPGA-status -monitor {-interval [ms >= " << STATUS_MONITOR_INTERVAL_MIN_MS << "]}" \
+				 << " {-textfile [path]} {-port [port]} {-count [samples]}" << endl;
+			cout << "         A textfile or a port is required" << endl;
+			return 1;
+		}
+		return runStatusMonitor(cfg) ? 0 : 1;
 	}
 
-    // Allocate a pointer to the maped address space 
-    ptrclkmgr = (uint32_t*)clkmgrMap;
-
-    if (ptrclkmgr==0) 
-    {
-        cout << "\n[ERROR] Failed to allocate a ponter to the to the Clock Manager"<<endl;
-        return -1;
-    }
-
-
-    return 1;
-}
-
-/* 
- * @ brief      Deinit all open MAPs and ports  
- *
-*/
-void deinit(void)
-{
-    // Close the MMAP for the FPGA Manager Address Space
-    if (fpgaMangerMap != MAP_FAILED)
-    {
-        munmap((void*) fpgaMangerMap, 4);
-    }
+	// Read all registers in one pass
+	statusSnapshot_t snap;
+	int res = statusCapture(&snap);
+	rsMemClose();
 
-	if (wdt0Map != MAP_FAILED)
+	// Machine-readable output (also with the result of a failed capture)
+	if (rawMode)
 	{
-		munmap((void*) wdt0Map, REG_WDT0_BASE);
+		ssize_t len = write(STDOUT_FILENO, &snap, sizeof(snap));
+		return ((res == RSMEM_SUCCESS) && (len == (ssize_t) sizeof(snap))) ? 0 : 1;
 	}
-
-	if (wdt1Map != MAP_FAILED)
+	if (jsonMode)
 	{
-		munmap((void*) wdt1Map, REG_WDT1_BASE);
+		char json[STATUS_JSON_SIZE];
+		size_t len = statusFormatJson(&snap, json, sizeof(json) - 1);
+		json[len++] = '\n';
+		ssize_t written = write(STDOUT_FILENO, json, len);
+		return ((res == RSMEM_SUCCESS) && (written == (ssize_t) len)) ? 0 : 1;
 	}
 
-	if (clkmgrMap != MAP_FAILED)
+	if (res != RSMEM_SUCCESS)
 	{
-		munmap((void*) clkmgrMap, REG_CLCK_CTRL);
+		cout << "[ERROR]  Failed to read the status registers!" << endl;
+		return -1;
 	}
 
-    // close POSIX port
-    close(posix_fd);
-}
-
-
-/*
-*   @brief              Read FPGA MSEL (FPGA Configuration Mode) Selection 
-*   @return             MSEL Code         
-*/ 
-uint8_t readMSEL(void)
-{	
-	if (ptrFpgaManger==0) return 0;
-	// Read Bit 3-7 of the FPGA Manager Status register
-	uint32_t stat = *(ptrFpgaManger + (REG_FPGAMG_STATUS_OFFSET)) & 0xF8;
-	return (uint8_t) (stat >> 3); 
-}
-
-
-/*
-*   @brief              Read FPGA Fabric State 
-*   @return             State Code         
-*/ 
-uint8_t readState(void)
-{	
-	if (ptrFpgaManger==0) return 0xFF;
-	// Read Bit 0-3 of the FPGA Manager Status register
-	uint32_t stat = *(ptrFpgaManger + (REG_FPGAMG_STATUS_OFFSET)) & 0x7;
-	return (uint8_t) stat;
-}
-
-
-/*
-*   @brief              Read BSEL (Boot Select Register)
-*   @return             BSEL Code         
-*/ 
-uint8_t readBSL(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	// Read Bit 0-3 of the System Manager Boot Configuration Register
-	uint32_t bsl = *(ptrsystemManger + (REG_SYSMAN_BOOTINFO_OFFSET/4)) & 0x7;
-	return (uint8_t) bsl; 
-}
-
-
-/*
-*   @brief              Read if the Device has CAN Bus
-*   @return             has CAN0 and CAN1          
-*/ 
-uint8_t hasCan(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	// Read Bit 1 of the System Manager HPS Register
-	uint32_t can = *(ptrsystemManger + (REG_SYSMAN_HPSINFO_OFFSET/4)) & 0b01;
-	return (uint8_t) can; 
-}
-
-/*
-*   @brief              Read if the HPS has a Dual-Core CPU
-*   @return             has Dual-Core         
-*/ 
-uint8_t isDualCore(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	// Read Bit 1 of the System Manager HPS Register
-	uint32_t dualcore = *(ptrsystemManger + (REG_SYSMAN_HPSINFO_OFFSET/4)) & 0b1;
-	return (uint8_t) dualcore; 
-}
-
-/*
-*   @brief              Read if the global interface between FPGA and HPS disabled
-*   @return             0  	All interfaces between FPGA and HPS are disabled.
-*/ 
-uint8_t isGlobalInterfaceEnbaled(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	return *(ptrsystemManger + (REG_SYSMAN_GBL_OFFSET/4)) & 0b1;
-}
-
-
-/*
-*   @brief              Get System Manager indiv Register
-*   @return             indiv register [7:0]
-*/ 
-uint8_t readSysManIndiv(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	return *(ptrsystemManger + (REG_SYSMAN_INDIV_OFFSET/4)) & 0xFF;
-}
-
-/*
-*   @brief              Read the Silicon Revison Number
-*   @return             Silicion Revison Number       
-*/ 
-uint16_t readSiliconRev(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	uint32_t rev = *(ptrsystemManger + (REG_SYSMAN_SILID_OFFSET/4)) & 0xFFFF;
-	return (uint16_t) rev; 
-}
-
-/*
-*   @brief              Read the Silicon ID
-*   @return             Silicion ID     
-*/ 
-uint16_t readSiliconID(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	uint32_t id = *(ptrsystemManger + (REG_SYSMAN_SILID_OFFSET/4)) & 0xFFFF0000;
-	return (uint16_t) (id >> 16); 
-}
+	uint8_t  msel_code 	 	= statusMsel(&snap);
+	uint8_t  state_code  	= statusState(&snap);
+	uint8_t  bsel_code   	= statusBsel(&snap);
+	uint8_t  has_can	 	= statusCan(&snap);
+	uint8_t  is_dualcore 	= statusDualCore(&snap);
+	uint16_t silicon_rev 	= statusSiliconRev(&snap);
+	uint16_t silicon_id  	= statusSiliconId(&snap);
+	uint8_t  watchDog0_en   = statusWatchDog(&snap, 0);
+	uint8_t  watchDog1_en   = statusWatchDog(&snap, 1);
+	uint8_t  global_inf_en  = statusGlobalIf(&snap);
+	uint8_t  indiv_code		= statusIndiv(&snap);
+	uint8_t  signal_en		= statusModule(&snap);
+	uint8_t  clock_ctrl		= statusClockCtrl(&snap);
+
+	// Print the MSEL Value as detailed string 
+	cout << "-- Reading the Status of the FPGA Fabric --" << endl;
+
+	cout << "# MSEL (Mode Select) Position:" <<endl;
+	cout << msel2str(msel_code) << endl;
+
+	cout << "# FPGA Fabric State:" <<endl;
+	cout << state2str(state_code) << endl;
+
+	cout << "# HPS Boot Select (BSEL):" <<endl;
+	cout << bsl2str(bsel_code) << endl;
+
+	cout << "# HPS Info:" <<endl;
+	if (is_dualcore==1) cout << "	        [Y] Is dual-core (CPU0 and CPU1 both available)."<<endl;
+	else				cout << "	        [N] Not dual-core (only CPU0 available)."<<endl;
+	
+	if (has_can==1) 	cout << "	        [Y] CAN0 and CAN1 are available"<<endl;
+	else				cout << "	        [N] CAN0 and CAN1 are not available"<<endl;
+	
+	cout << "	        Silicon revision No: "<<silicon_rev;
+	if 		(silicon_rev==0x1) cout << " (First Silicon)"<<endl;
+	else if (silicon_rev==0x2) cout << " (Silicon with L2 ECC fix)"<<endl;
+	else if (silicon_rev==0x1) cout << " (Silicon with HPS PLL (warm reset) fix)"<<endl;
+	else cout <<endl;
 
-/*
-*   @brief              Read module Signal Enable Register
-*   @return             Register [5:0]  
-*/ 
-uint8_t readModuleSignalEn(void)
-{	
-	if (ptrsystemManger==0) return 255;
-	uint32_t module = *(ptrsystemManger + (REG_SYSMAN_MODULE_OFFSET/4)) & 0x1F;;
-	return (uint8_t) module; 
-}
+	cout << "	        Silicon ID: "<<silicon_id <<endl;
+	
+	cout << "# WatchDog Status:" <<endl;
 
-/*
-*   @brief              Read the Clock Manger Controll Register
-*   @return             indiv register [7:0]
-*/ 
-uint8_t readClockCtrl(void)
-{	
-	if (ptrclkmgr==0) return 255;
-	return *(ptrclkmgr + (REG_CLCK_CTRL_OFFFSET/4)) & 0x7;
-}
+	if (watchDog0_en==1) 	cout << "	  L     [Y] Watchdog 0 enabled and generates a warm reset request"<<endl;
+	else					cout << "	  L     [N] Watchdog 0 disabled"<<endl;
 
+	if (watchDog1_en==1) 	cout << "	  L     [Y] Watchdog 1 enabled and generates a warm reset request"<<endl;
+	else					cout << "	  L     [N] Watchdog 1 disabled"<<endl;
 
-/*
-*   @brief              Check if WatchDog 0 is enbaled
-*   @return             WatchDog 0 enbaled     
-*/ 
-uint8_t WatchDog0Enabled(void)
-{	
-	if (ptrwdt0==0) return 0;
-	uint32_t wdt = *(ptrwdt0 + (REG_WDT0_OFFFSET/4));
-	return (uint8_t) ((wdt & (1<<0)) && !(wdt & (1<<1)));
-}
+	cout << "#  Interfaces/Signals between the FPGA and HPS:" <<endl;
 
-/*
-*   @brief              Check if WatchDog 1 is enbaled
-*   @return             WatchDog 1 enbaled     
-*/ 
-uint8_t WatchDog1Enabled(void)
-{	
-	if (ptrwdt1==0) return 0;
-	uint32_t wdt = *(ptrwdt1 + (REG_WDT1_OFFFSET/4));
-	return (uint8_t) ((wdt & (1<<0)) && !(wdt & (1<<1)));
-}
-
-int main(int argc, const char* argv[])
-{
-
-	if(initMemRegs()==-1) return -1;
-
-	uint8_t  msel_code 	 	= readMSEL();
-	uint8_t  state_code  	= readState();
-	uint8_t  bsel_code   	= readBSL();
-	uint8_t  has_can	 	= hasCan();
-	uint8_t  is_dualcore 	= isDualCore();
-	uint16_t silicon_rev 	= readSiliconRev();
-	uint16_t silicon_id  	= readSiliconID();
-	uint8_t  watchDog0_en   = WatchDog0Enabled();
-	uint8_t  watchDog1_en   = WatchDog1Enabled();
-	uint8_t  global_inf_en  = isGlobalInterfaceEnbaled();
-	uint8_t  indiv_code		= readSysManIndiv();
-	uint8_t  signal_en		= readModuleSignalEn();
-	uint8_t  clock_ctrl		= readClockCtrl();
+	if (global_inf_en==1) 	cout << "	   L    [Y] Interfaces between FPGA and HPS are not all global disabled"<<endl;
+	else					cout << "	   L    [N] [INTERFACE GLOBAL RESET] All interfaces between FPGA and HPS are disabled."<<endl;
 	
-	string stat ="";
+	cout << "	        General Signals of the HPS Module"<<endl;
+	cout << indiv2str(indiv_code)<<endl;
+	cout << "	        Specific module signals Enabled/Disabled"<<endl;
+	cout << moudleEn2str(signal_en)<<endl;
 
-	if ((argc > 1) && (std::string(argv[1]) == "-h"))
-	{
-		cout << "	Command to read current Status of the HPS and FPGA Fabric" << endl;
-		cout << "	FPGA-status" << endl;
-		cout << "		Read the status with detailed output" << endl;
-		cout <<endl <<"Vers.: "<<VERSION<<endl;
-		cout <<"Copyright (C) 2020-2022 rsyocto GmbH & Co. KG" << endl;
-
-	}
-	else
-	{
-		// Print the MSEL Value as detailed string 
-		cout << "-- Reading the Status of the FPGA Fabric --" << endl;
-
-		cout << "# MSEL (Mode Select) Position:" <<endl;
-		cout << msel2str(msel_code) << endl;
-
-		cout << "# FPGA Fabric State:" <<endl;
-		cout << state2str(state_code) << endl;
-
-		cout << "# HPS Boot Select (BSEL):" <<endl;
-		cout << bsl2str(bsel_code) << endl;
-
-		cout << "# HPS Info:" <<endl;
-		if (is_dualcore==1) cout << "	        [Y] Is dual-core (CPU0 and CPU1 both available)."<<endl;
-		else				cout << "	        [N] Not dual-core (only CPU0 available)."<<endl;
-		
-		if (has_can==1) 	cout << "	        [Y] CAN0 and CAN1 are available"<<endl;
-		else				cout << "	        [N] CAN0 and CAN1 are not available"<<endl;
-		
-		cout << "	        Silicon revision No: "<<silicon_rev;
-		if 		(silicon_rev==0x1) cout << " (First Silicon)"<<endl;
-		else if (silicon_rev==0x2) cout << " (Silicon with L2 ECC fix)"<<endl;
-		else if (silicon_rev==0x1) cout << " (Silicon with HPS PLL (warm reset) fix)"<<endl;
-		else cout <<endl;
-
-		cout << "	        Silicon ID: "<<silicon_id <<endl;
-		
-		cout << "# WatchDog Status:" <<endl;
-
-		if (watchDog0_en==1) 	cout << "	  L     [Y] Watchdog 0 enabled and generates a warm reset request"<<endl;
-		else					cout << "	  L     [N] Watchdog 0 disabled"<<endl;
-
-		if (watchDog1_en==1) 	cout << "	  L     [Y] Watchdog 1 enabled and generates a warm reset request"<<endl;
-		else					cout << "	  L     [N] Watchdog 1 disabled"<<endl;
-
-		cout << "#  Interfaces/Signals between the FPGA and HPS:" <<endl;
-
-		if (global_inf_en==1) 	cout << "	   L    [Y] Interfaces between FPGA and HPS are not all global disabled"<<endl;
-		else					cout << "	   L    [N] [INTERFACE GLOBAL RESET] All interfaces between FPGA and HPS are disabled."<<endl;
-		
-		cout << "	        General Signals of the HPS Module"<<endl;
-		cout << indiv2str(indiv_code)<<endl;
-		cout << "	        Specific module signals Enabled/Disabled"<<endl;
-		cout << moudleEn2str(signal_en)<<endl;
-
-		cout << "#  Clock Manager Settings" <<endl;
-		cout << clockCtrl2str(clock_ctrl)<< endl;
-	}
+	cout << "#  Clock Manager Settings" <<endl;
+	cout << clockCtrl2str(clock_ctrl)<< endl;
 
-	deinit();
 	return 0;
 }
@@ -0,0 +1,211 @@
+/**
+ *
+ * @file    status_monitor.cpp
+ * @brief   FPGA-status
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Continuous monitor of the FPGA and HPS status with Prometheus export
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "status_monitor.h"
+#include "status_snapshot.h"		// snapshot of the status registers
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_time.h"			// rstools timestamps
+
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <iostream>
+#include <fcntl.h>					// POSIX: open
+#include <unistd.h>					// POSIX: write, close
+#include <poll.h>					// POSIX: poll
+#include <sys/socket.h>				// POSIX: socket, bind, listen, accept
+#include <netinet/in.h>				// POSIX: sockaddr_in
+#include <arpa/inet.h>				// POSIX: htonl, htons
+
+using namespace std;
+
+static volatile sig_atomic_t stopRequest = 0;
+
+static void onSignal(int)
+{
+	stopRequest = 1;
+}
+
+/*
+*   @brief               Write the whole buffer to a file descriptor
+*   @return              success
+*/
+static bool writeFull(int fd, const char* buf, size_t len)
+{
+	while (len > 0)
+	{
+		ssize_t res = write(fd, buf, len);
+		if (res < 0)
+		{
+			if (errno == EINTR) continue;
+			return false;
+		}
+		buf += res;
+		len -= res;
+	}
+	return true;
+}
+
+/*
+*   @brief               Replace the textfile atomically
+*   @return              success
+*/
+static bool writeTextFile(const string& path, const char* buf, size_t len)
+{
+	string tmp = path + ".tmp";
+	int fd = open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0) return false;
+
+	bool ok = writeFull(fd, buf, len);
+	ok = (close(fd) == 0) && ok;
+	if (ok && (rename(tmp.c_str(), path.c_str()) == 0))
+		return true;
+	unlink(tmp.c_str());
+	return false;
+}
+
+/*
+*   @brief               Open the HTTP socket on 127.0.0.1
+*   @return              socket or -1
+*/
+static int openHttp(uint16_t port)
+{
+	int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0) return -1;
+
+	int on = 1;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if ((bind(fd, (struct sockaddr*) &addr, sizeof(addr)) != 0) || (listen(fd, 8) != 0))
+	{
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/*
+*   @brief               Answer one HTTP request with the last metrics
+*/
+static void serveHttp(int listenFd, const char* metrics, size_t len)
+{
+	int fd = accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+	if (fd < 0) return;
+
+	// A slow client must not delay the next sample
+	struct timeval tmo = { 0, STATUS_MONITOR_HTTP_TIMEOUT_MS * 1000 };
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tmo, sizeof(tmo));
+	setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tmo, sizeof(tmo));
+
+	// The request is not evaluated, every path returns the metrics
+	char request[1024];
+	if (recv(fd, request, sizeof(request), 0) > 0)
+	{
+		char header[160];
+		int headerLen = snprintf(header, sizeof(header),
+			"HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+			"Content-Length: %zu\r\nConnection: close\r\n\r\n", len);
+		if (writeFull(fd, header, headerLen))
+			writeFull(fd, metrics, len);
+	}
+	close(fd);
+}
+
+bool runStatusMonitor(const statusMonitorCfg_t& cfg)
+{
+	int httpFd = -1;
+	if (cfg.port != 0)
+	{
+		httpFd = openHttp(cfg.port);
+		if (httpFd < 0)
+		{
+			cout << "[ ERROR ] Failed to open the HTTP port " << cfg.port << "!" << endl;
+			return false;
+		}
+	}
+
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = onSignal;
+	sigaction(SIGINT, &sa, nullptr);
+	sigaction(SIGTERM, &sa, nullptr);
+	signal(SIGPIPE, SIG_IGN);
+
+	cout << "[ INFO ] Monitoring the FPGA status every " << cfg.interval_ms << " ms";
+	if (!cfg.textFile.empty()) cout << ", textfile: " << cfg.textFile;
+	if (httpFd >= 0) cout << ", http://127.0.0.1:" << cfg.port << "/metrics";
+	cout << endl;
+
+	char metrics[STATUS_PROM_SIZE];
+	size_t metricsLen = 0;
+	uint64_t samples = 0;
+	bool fileOk = true;
+	uint64_t interval = (uint64_t) cfg.interval_ms * 1000000ULL;
+	uint64_t deadline = rsTimeNowNs();
+
+	while (!stopRequest)
+	{
+		// The windows (or the rstoolsd connection) stay open between the samples
+		statusSnapshot_t snap;
+		if (statusCapture(&snap) != RSMEM_SUCCESS)
+		{
+			// Open the driver (or connect to a restarted rstoolsd) again for the next sample
+			rsMemClose();
+		}
+		samples++;
+		metricsLen = statusFormatPrometheus(&snap, samples, metrics, sizeof(metrics));
+
+		if (!cfg.textFile.empty())
+		{
+			bool ok = writeTextFile(cfg.textFile, metrics, metricsLen);
+			if (!ok && fileOk)
+				cout << "[ WARNING ] Failed to write " << cfg.textFile << endl;
+			fileOk = ok;
+		}
+
+		if ((cfg.count != 0) && (samples >= cfg.count))
+			break;
+
+		// Serve HTTP requests until the next sample, a late sample does not catch up
+		deadline += interval;
+		uint64_t now = rsTimeNowNs();
+		if (deadline < now)
+			deadline = now + interval;
+
+		while (!stopRequest && ((now = rsTimeNowNs()) < deadline))
+		{
+			int timeout_ms = (int) ((deadline - now + 999999) / 1000000);
+			struct pollfd pfd = { httpFd, POLLIN, 0 };
+			int res = poll(&pfd, (httpFd >= 0) ? 1 : 0, timeout_ms);
+			if ((res > 0) && (pfd.revents & POLLIN))
+				serveHttp(httpFd, metrics, metricsLen);
+		}
+	}
+
+	if (httpFd >= 0)
+		close(httpFd);
+	rsMemClose();
+
+	cout << "[ INFO ] Monitor stopped after " << samples << " samples" << endl;
+	return fileOk;
+}
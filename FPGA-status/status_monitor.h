@@ -0,0 +1,55 @@
+/**
+ *
+ * @file    status_monitor.h
+ * @brief   FPGA-status
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Continuous monitor of the FPGA and HPS status with Prometheus export
+ *
+ * The monitor keeps the memory driver (or the rstoolsd connection) open and
+ * captures a snapshot of the status registers every interval. The metrics are
+ * written to a textfile of the node_exporter textfile collector (written to
+ * "<file>.tmp" and renamed, the collector never reads a partial file) and/or
+ * served over HTTP on 127.0.0.1:<port> (any request path returns the metrics).
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef STATUS_MONITOR_H
+#define STATUS_MONITOR_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <string>
+
+// Default and minimal sample interval
+#define STATUS_MONITOR_INTERVAL_MS		5000
+#define STATUS_MONITOR_INTERVAL_MIN_MS	10
+
+// Time a HTTP client may take to send its request
+#define STATUS_MONITOR_HTTP_TIMEOUT_MS	200
+
+/*
+* Settings of the monitor
+*/
+typedef struct
+{
+	uint32_t interval_ms;			// sample interval
+	std::string textFile;			// Prometheus textfile (empty: none)
+	uint16_t port;					// HTTP port on 127.0.0.1 (0: none)
+	uint64_t count;					// number of samples (0: until SIGINT/SIGTERM)
+} statusMonitorCfg_t;
+
+/*
+*   @brief               Run the monitor
+*	@param	cfg			 settings
+*   @return              success
+*/
+bool runStatusMonitor(const statusMonitorCfg_t& cfg);
+
+#endif // STATUS_MONITOR_H
@@ -0,0 +1,291 @@
+/**
+ *
+ * @file    status_snapshot.cpp
+ * @brief   FPGA-status
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Snapshot of all status registers of the FPGA Fabric and the HPS
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Prometheus text format
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "status_snapshot.h"
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_client.h"			// rstoolsd daemon
+
+#include <cstdio>
+#include <cstring>
+#include <cstdarg>
+#include <ctime>
+#include <algorithm>
+
+using namespace std;
+
+/*
+* Address and JSON name of the captured registers (order of statusReg_t)
+*/
+static const struct
+{
+	uint32_t address;
+	const char* name;
+} statusRegs[STATUS_REGS] =
+{
+	{ 0xFF706000, "fpgamgr_stat" },
+	{ 0xFFD08000, "sysmgr_siliconid" },
+	{ 0xFFD08014, "sysmgr_bootinfo" },
+	{ 0xFFD08018, "sysmgr_hpsinfo" },
+	{ 0xFFD08020, "sysmgr_gbl" },
+	{ 0xFFD08024, "sysmgr_indiv" },
+	{ 0xFFD08028, "sysmgr_module" },
+	{ 0xFFD02000, "wdt0_cr" },
+	{ 0xFFD03000, "wdt1_cr" },
+	{ 0xFFD04000, "clkmgr_ctrl" }
+};
+
+/*
+* Named bits of the interface enable registers (as described by FPGA-status)
+*/
+typedef struct
+{
+	uint8_t bit;
+	const char* name;
+} statusBit_t;
+
+static const statusBit_t indivBits[] =
+{
+	{ 0, "rstreq" }, { 1, "jtag" }, { 2, "configio" }, { 3, "bscan" },
+	{ 4, "trace" }, { 6, "stmevent" }, { 7, "crosstrig" }
+};
+
+static const statusBit_t moduleBits[] =
+{
+	{ 0, "spim0" }, { 1, "spim1" }, { 2, "emac0" }, { 3, "emac1" }, { 5, "sdmmc" }
+};
+
+int statusCapture(statusSnapshot_t* snap)
+{
+	memset(snap, 0, sizeof(statusSnapshot_t));
+	memcpy(snap->magic, STATUS_SNAPSHOT_MAGIC, 4);
+	snap->version = STATUS_SNAPSHOT_VERSION;
+	snap->regs = STATUS_REGS;
+
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	snap->time_ns = (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+
+	snap->status = rsMemOpen();
+	if (snap->status != RSMEM_SUCCESS)
+		return snap->status;
+
+	if (rsMemIsRemote())
+	{
+		// All registers with one round trip to rstoolsd
+		rsClientOp_t ops[STATUS_REGS];
+		memset(ops, 0, sizeof(ops));
+		for (uint8_t i = 0; i < STATUS_REGS; i++)
+		{
+			ops[i].req.op = RSPROTO_OP_READ;
+			ops[i].req.address = statusRegs[i].address;
+		}
+		snap->status = rsClientBatch(ops, STATUS_REGS);
+		for (uint8_t i = 0; (snap->status == RSMEM_SUCCESS) && (i < STATUS_REGS); i++)
+		{
+			snap->status = ops[i].resp.status;
+			snap->reg[i] = ops[i].resp.value;
+		}
+	}
+	else
+	{
+		// The windows stay cached for the next capture
+		for (uint8_t i = 0; (snap->status == RSMEM_SUCCESS) && (i < STATUS_REGS); i++)
+		{
+			uint32_t value = 0;
+			snap->status = rsMemRead(statusRegs[i].address, &value);
+			snap->reg[i] = value;
+		}
+	}
+	return snap->status;
+}
+
+uint8_t statusMsel(const statusSnapshot_t* snap)
+{
+	// Bit 3-7 of the FPGA Manager Status register
+	return (uint8_t) ((snap->reg[STATUS_REG_FPGAMGR_STAT] & 0xF8) >> 3);
+}
+
+uint8_t statusState(const statusSnapshot_t* snap)
+{
+	// Bit 0-2 of the FPGA Manager Status register
+	return (uint8_t) (snap->reg[STATUS_REG_FPGAMGR_STAT] & 0x7);
+}
+
+uint8_t statusBsel(const statusSnapshot_t* snap)
+{
+	return (uint8_t) (snap->reg[STATUS_REG_SYSMGR_BOOTINFO] & 0x7);
+}
+
+uint8_t statusDualCore(const statusSnapshot_t* snap)
+{
+	return (uint8_t) (snap->reg[STATUS_REG_SYSMGR_HPSINFO] & (1<<0));
+}
+
+uint8_t statusCan(const statusSnapshot_t* snap)
+{
+	return (uint8_t) ((snap->reg[STATUS_REG_SYSMGR_HPSINFO] >> 1) & 1);
+}
+
+uint16_t statusSiliconRev(const statusSnapshot_t* snap)
+{
+	return (uint16_t) (snap->reg[STATUS_REG_SYSMGR_SILICONID] & 0xFFFF);
+}
+
+uint16_t statusSiliconId(const statusSnapshot_t* snap)
+{
+	return (uint16_t) (snap->reg[STATUS_REG_SYSMGR_SILICONID] >> 16);
+}
+
+uint8_t statusWatchDog(const statusSnapshot_t* snap, uint8_t wdt)
+{
+	uint32_t cr = snap->reg[(wdt == 0) ? STATUS_REG_WDT0_CR : STATUS_REG_WDT1_CR];
+	return (uint8_t) ((cr & (1<<0)) && !(cr & (1<<1)));
+}
+
+uint8_t statusGlobalIf(const statusSnapshot_t* snap)
+{
+	return (uint8_t) (snap->reg[STATUS_REG_SYSMGR_GBL] & (1<<0));
+}
+
+uint8_t statusIndiv(const statusSnapshot_t* snap)
+{
+	return (uint8_t) (snap->reg[STATUS_REG_SYSMGR_INDIV] & 0xFF);
+}
+
+uint8_t statusModule(const statusSnapshot_t* snap)
+{
+	return (uint8_t) (snap->reg[STATUS_REG_SYSMGR_MODULE] & 0x3F);
+}
+
+uint8_t statusClockCtrl(const statusSnapshot_t* snap)
+{
+	return (uint8_t) (snap->reg[STATUS_REG_CLKMGR_CTRL] & 0x7);
+}
+
+const char* statusStateName(uint8_t state_code)
+{
+	switch (state_code)
+	{
+		case 0x00: return "powered_off";
+		case 0x01: return "reset";
+		case 0x02: return "configuration";
+		case 0x03: return "initialization";
+		case 0x04: return "user_mode";
+		case 0x05: return "undetermined";
+	}
+	return "unknown";
+}
+
+size_t statusFormatJson(const statusSnapshot_t* snap, char* buf, size_t len)
+{
+	int pos = snprintf(buf, len,
+		"{\"version\":%u,\"time_ns\":%llu,\"status\":%d,"
+		"\"fpga\":{\"state\":%u,\"state_name\":\"%s\",\"msel\":%u},"
+		"\"hps\":{\"bsel\":%u,\"dual_core\":%u,\"can\":%u,\"silicon_id\":%u,\"silicon_rev\":%u},"
+		"\"watchdog\":[%u,%u],"
+		"\"interfaces\":{\"global\":%u,\"indiv\":%u,\"module\":%u},"
+		"\"clock_ctrl\":%u,\"regs\":{",
+		snap->version, (unsigned long long) snap->time_ns, snap->status,
+		statusState(snap), statusStateName(statusState(snap)), statusMsel(snap),
+		statusBsel(snap), statusDualCore(snap), statusCan(snap), statusSiliconId(snap), statusSiliconRev(snap),
+		statusWatchDog(snap, 0), statusWatchDog(snap, 1),
+		statusGlobalIf(snap), statusIndiv(snap), statusModule(snap),
+		statusClockCtrl(snap));
+
+	for (uint8_t i = 0; (i < STATUS_REGS) && (pos > 0) && ((size_t) pos < len); i++)
+		pos += snprintf(buf + pos, len - pos, "%s\"%s\":%u", (i > 0) ? "," : "", statusRegs[i].name, snap->reg[i]);
+	if ((pos > 0) && ((size_t) pos < len))
+		pos += snprintf(buf + pos, len - pos, "}}");
+
+	if (pos < 0) return 0;
+	return ((size_t) pos < len) ? pos : len - 1;
+}
+
+/*
+*   @brief               Append formatted text to a buffer (the output is cut at the end of the buffer)
+*/
+static void appendText(char* buf, size_t len, size_t* pos, const char* fmt, ...) __attribute__((format(printf, 4, 5)));
+static void appendText(char* buf, size_t len, size_t* pos, const char* fmt, ...)
+{
+	if (*pos + 1 >= len) return;
+	va_list args;
+	va_start(args, fmt);
+	int res = vsnprintf(buf + *pos, len - *pos, fmt, args);
+	va_end(args);
+	if (res > 0)
+		*pos = min(*pos + (size_t) res, len - 1);
+}
+
+/*
+*   @brief               Append a gauge with a value per named bit of a register
+*/
+static void appendBits(char* buf, size_t len, size_t* pos, const char* metric, const char* help, \
+	uint32_t value, const statusBit_t* bits, size_t count)
+{
+	appendText(buf, len, pos, "# HELP %s %s\n# TYPE %s gauge\n", metric, help, metric);
+	for (size_t i = 0; i < count; i++)
+		appendText(buf, len, pos, "%s{signal=\"%s\"} %u\n", metric, bits[i].name, (value >> bits[i].bit) & 1);
+}
+
+size_t statusFormatPrometheus(const statusSnapshot_t* snap, uint64_t samples, char* buf, size_t len)
+{
+	size_t pos = 0;
+	if (len == 0) return 0;
+	buf[0] = '\0';
+
+	appendText(buf, len, &pos,
+		"# HELP rstools_status_up 1 if the status registers were read\n"
+		"# TYPE rstools_status_up gauge\n"
+		"rstools_status_up %u\n"
+		"# HELP rstools_status_samples_total Captures of the status registers\n"
+		"# TYPE rstools_status_samples_total counter\n"
+		"rstools_status_samples_total %llu\n",
+		(snap->status == RSMEM_SUCCESS) ? 1 : 0, (unsigned long long) samples);
+
+	// Without a valid capture only the health of the monitor is exported
+	if (snap->status != RSMEM_SUCCESS)
+		return pos;
+
+	uint8_t state = statusState(snap);
+	appendText(buf, len, &pos,
+		"# HELP rstools_fpga_state FPGA Fabric State Code\n"
+		"# TYPE rstools_fpga_state gauge\n"
+		"rstools_fpga_state{name=\"%s\"} %u\n"
+		"# HELP rstools_fpga_user_mode 1 if the FPGA Fabric is in User Mode\n"
+		"# TYPE rstools_fpga_user_mode gauge\n"
+		"rstools_fpga_user_mode %u\n"
+		"# HELP rstools_fpga_msel FPGA MSEL (Mode Select) Code\n"
+		"# TYPE rstools_fpga_msel gauge\n"
+		"rstools_fpga_msel %u\n"
+		"# HELP rstools_watchdog_enabled 1 if the WatchDog is enabled\n"
+		"# TYPE rstools_watchdog_enabled gauge\n"
+		"rstools_watchdog_enabled{wdt=\"0\"} %u\n"
+		"rstools_watchdog_enabled{wdt=\"1\"} %u\n"
+		"# HELP rstools_fpga_interfaces_enabled 0 if all interfaces between FPGA and HPS are disabled\n"
+		"# TYPE rstools_fpga_interfaces_enabled gauge\n"
+		"rstools_fpga_interfaces_enabled %u\n",
+		statusStateName(state), state, (state == 0x04) ? 1 : 0, statusMsel(snap),
+		statusWatchDog(snap, 0), statusWatchDog(snap, 1), statusGlobalIf(snap));
+
+	appendBits(buf, len, &pos, "rstools_fpga_interface_signal_enabled", "HPS module signals from the FPGA Fabric enabled", \
+		statusIndiv(snap), indivBits, sizeof(indivBits) / sizeof(indivBits[0]));
+	appendBits(buf, len, &pos, "rstools_fpga_module_signal_enabled", "Signals from the FPGA Fabric to the HPS module enabled", \
+		statusModule(snap), moduleBits, sizeof(moduleBits) / sizeof(moduleBits[0]));
+	return pos;
+}
@@ -0,0 +1,120 @@
+/**
+ *
+ * @file    status_snapshot.h
+ * @brief   FPGA-status
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Snapshot of all status registers of the FPGA Fabric and the HPS
+ *
+ * All registers are read in one pass into a packed record, the decoded
+ * values are derived from the record. With the rstoolsd daemon the
+ * registers are read with a single batch.
+ *
+ * The record is also the output of "FPGA-status --raw" (host byte order):
+ * 		magic "RSFS", version, number of registers, UNIX time in ns,
+ * 		result of the capture (1: success), STATUS_REGS register values
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Prometheus text format
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef STATUS_SNAPSHOT_H
+#define STATUS_SNAPSHOT_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+#define STATUS_SNAPSHOT_MAGIC		"RSFS"
+#define STATUS_SNAPSHOT_VERSION		1
+
+// Buffer size that always holds the JSON output of a snapshot
+#define STATUS_JSON_SIZE			1024
+// Buffer size that always holds the Prometheus output of a snapshot
+#define STATUS_PROM_SIZE			8192
+
+/*
+* Captured registers (index of statusSnapshot_t::reg)
+*/
+typedef enum
+{
+	STATUS_REG_FPGAMGR_STAT = 0,		// FPGA Manager Status Register (MSEL, State)
+	STATUS_REG_SYSMGR_SILICONID,		// System Manager Silicon ID and Revision
+	STATUS_REG_SYSMGR_BOOTINFO,			// System Manager Boot Information (BSEL)
+	STATUS_REG_SYSMGR_HPSINFO,			// System Manager HPS Information (Dual-Core, CAN)
+	STATUS_REG_SYSMGR_GBL,				// System Manager FPGA Interface Global Enable
+	STATUS_REG_SYSMGR_INDIV,			// System Manager FPGA Interface Individual Enable
+	STATUS_REG_SYSMGR_MODULE,			// System Manager Module Signal Enable
+	STATUS_REG_WDT0_CR,					// WatchDog 0 Control Register
+	STATUS_REG_WDT1_CR,					// WatchDog 1 Control Register
+	STATUS_REG_CLKMGR_CTRL,				// Clock Manager Control Register
+	STATUS_REGS
+} statusReg_t;
+
+/*
+* Snapshot of the status registers
+*/
+typedef struct __attribute__((packed))
+{
+	char magic[4];						// "RSFS"
+	uint16_t version;					// STATUS_SNAPSHOT_VERSION
+	uint16_t regs;						// STATUS_REGS
+	uint64_t time_ns;					// UNIX time of the capture in ns
+	int32_t status;						// RSMEM_SUCCESS or the error of the capture
+	uint32_t reg[STATUS_REGS];			// register values
+} statusSnapshot_t;
+
+/*
+*   @brief               Read all status registers in one pass
+*	@param	snap		 captured registers
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER (also in snap->status)
+*/
+int statusCapture(statusSnapshot_t* snap);
+
+/*
+*   @brief               Decoded values of a snapshot (according to the datasheet)
+*/
+uint8_t statusMsel(const statusSnapshot_t* snap);			// FPGA MSEL Code
+uint8_t statusState(const statusSnapshot_t* snap);			// FPGA Fabric State Code
+uint8_t statusBsel(const statusSnapshot_t* snap);			// HPS Boot Select Code
+uint8_t statusDualCore(const statusSnapshot_t* snap);		// HPS has a Dual-Core CPU
+uint8_t statusCan(const statusSnapshot_t* snap);			// HPS has CAN0 and CAN1
+uint16_t statusSiliconRev(const statusSnapshot_t* snap);	// Silicon Revision Number
+uint16_t statusSiliconId(const statusSnapshot_t* snap);		// Silicon ID
+uint8_t statusWatchDog(const statusSnapshot_t* snap, uint8_t wdt);	// WatchDog 0/1 enabled
+uint8_t statusGlobalIf(const statusSnapshot_t* snap);		// 0: all FPGA-HPS interfaces are disabled
+uint8_t statusIndiv(const statusSnapshot_t* snap);			// Individual interface enables [7:0]
+uint8_t statusModule(const statusSnapshot_t* snap);			// Module signal enables [5:0]
+uint8_t statusClockCtrl(const statusSnapshot_t* snap);		// Clock Manager Control [2:0]
+
+/*
+*   @brief               Short name of a FPGA Fabric State Code (e.g. "user_mode")
+*/
+const char* statusStateName(uint8_t state_code);
+
+/*
+*   @brief               Format a snapshot as single line JSON object
+*	@param	snap		 captured registers
+*	@param	buf			 output buffer (STATUS_JSON_SIZE bytes are always enough)
+*	@param	len			 size of the buffer
+*   @return              length of the output (without the terminating zero)
+*/
+size_t statusFormatJson(const statusSnapshot_t* snap, char* buf, size_t len);
+
+/*
+*   @brief               Format a snapshot in the Prometheus text exposition format
+*	@param	snap		 captured registers
+*	@param	samples		 number of captures of the monitor (counter)
+*	@param	buf			 output buffer (STATUS_PROM_SIZE bytes are always enough)
+*	@param	len			 size of the buffer
+*   @return              length of the output (without the terminating zero)
+*/
+size_t statusFormatPrometheus(const statusSnapshot_t* snap, uint64_t samples, char* buf, size_t len);
+
+#endif // STATUS_SNAPSHOT_H
@@ -0,0 +1,134 @@
+/**
+ *
+ * @file    fill_pattern.cpp
+ * @brief   FPGA-writeBridge
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Fill a device memory range with a pattern and verify it (memory test)
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Store width of the fill
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "fill_pattern.h"
+#include "rstools_mem.h"			// rstools shared register access layer
+
+#include <cstring>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+bool fillParsePattern(const char* name, fillPattern_t* pattern)
+{
+	if 		(strcmp(name, "const") == 0) *pattern = FILL_CONST;
+	else if (strcmp(name, "inc") == 0)	 *pattern = FILL_INC;
+	else if (strcmp(name, "walk") == 0)	 *pattern = FILL_WALK;
+	else if (strcmp(name, "lfsr") == 0)	 *pattern = FILL_LFSR;
+	else return false;
+	return true;
+}
+
+void fillGenInit(fillGen_t* gen, fillPattern_t pattern, uint32_t value)
+{
+	gen->pattern = pattern;
+	gen->value = value;
+	gen->index = 0;
+}
+
+void fillGenNext(fillGen_t* gen, uint32_t* dst, size_t words)
+{
+	switch (gen->pattern)
+	{
+	case FILL_CONST:
+		for (size_t i = 0; i < words; i++)
+			dst[i] = gen->value;
+		break;
+	case FILL_INC:
+		for (size_t i = 0; i < words; i++)
+			dst[i] = gen->value + (uint32_t) (gen->index + i);
+		break;
+	case FILL_WALK:
+		for (size_t i = 0; i < words; i++)
+			dst[i] = 1u << ((gen->index + i) % 32);
+		break;
+	case FILL_LFSR:
+	{
+		uint32_t state = gen->value;
+		for (size_t i = 0; i < words; i++)
+		{
+			dst[i] = state;
+			state = (state >> 1) ^ ((state & 1) ? FILL_LFSR_TAPS : 0);
+		}
+		gen->value = state;
+		break;
+	}
+	}
+	gen->index += words;
+}
+
+int fillRange(uint32_t address, size_t length, fillPattern_t pattern, uint32_t value, uint8_t width)
+{
+	vector<uint32_t> chunk(FILL_CHUNK_SIZE / 4);
+	fillGen_t gen;
+	fillGenInit(&gen, pattern, value);
+
+	while (length > 0)
+	{
+		size_t len = (length > FILL_CHUNK_SIZE) ? FILL_CHUNK_SIZE : length;
+		fillGenNext(&gen, chunk.data(), len / 4);
+		if (rsMemWriteBlock(address, chunk.data(), (uint32_t) len, width) != RSMEM_SUCCESS)
+			return RSMEM_ERR_DRIVER;
+
+		address += len;
+		length  -= len;
+	}
+	return RSMEM_SUCCESS;
+}
+
+int verifyRange(uint32_t address, size_t length, fillPattern_t pattern, uint32_t value, \
+	bool printAll, bool ConsloeOutput, uint64_t* mismatches)
+{
+	vector<uint32_t> expected(FILL_CHUNK_SIZE / 4);
+	vector<uint32_t> read(FILL_CHUNK_SIZE / 4);
+	fillGen_t gen;
+	fillGenInit(&gen, pattern, value);
+
+	*mismatches = 0;
+	char line[128];
+	while (length > 0)
+	{
+		size_t len = (length > FILL_CHUNK_SIZE) ? FILL_CHUNK_SIZE : length;
+		fillGenNext(&gen, expected.data(), len / 4);
+		if (rsMemReadBlock(address, read.data(), (uint32_t) len) != RSMEM_SUCCESS)
+			return RSMEM_ERR_DRIVER;
+
+		// Compare the whole chunk first, mismatches are rare
+		if (memcmp(expected.data(), read.data(), len) != 0)
+		{
+			for (size_t i = 0; i < len / 4; i++)
+			{
+				if (expected[i] == read[i]) continue;
+				(*mismatches)++;
+				if (ConsloeOutput && (printAll || (*mismatches == 1)))
+				{
+					snprintf(line, sizeof(line), "   Mismatch at 0x%08x: expected 0x%08x read 0x%08x (xor 0x%08x)", \
+						address + (uint32_t) i * 4, expected[i], read[i], expected[i] ^ read[i]);
+					cout << line << endl;
+				}
+			}
+		}
+
+		address += len;
+		length  -= len;
+	}
+	return RSMEM_SUCCESS;
+}
@@ -0,0 +1,108 @@
+/**
+ *
+ * @file    fill_pattern.h
+ * @brief   FPGA-writeBridge
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Fill a device memory range with a pattern and verify it (memory test)
+ *
+ * The pattern is generated in chunks of FILL_CHUNK_SIZE in the application
+ * memory and written with rsMemWriteBlock: back-to-back stores of the selected
+ * width to the mapped range or block write requests over rstoolsd. 32-bit is
+ * the default and the only width of the Lightweight Bridge, ranges of the
+ * HPS-to-FPGA Bridge or the MPU address space can be written with 64-bit or
+ * 128-bit (NEON) stores. The verify pass
+ * generates the same pattern again and compares it with the range read back
+ * with rsMemReadBlock.
+ *
+ * Patterns (one 32-bit word per index i of the range):
+ *		const	value
+ *		inc		value + i
+ *		walk	1 << (i % 32)  (walking ones)
+ *		lfsr	32-bit Galois LFSR (x^32 + x^22 + x^2 + x + 1) started with the seed
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Store width of the fill
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef FILL_PATTERN_H
+#define FILL_PATTERN_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+// Chunk of the generated pattern (fits into the L2 cache)
+#define FILL_CHUNK_SIZE			(64UL*1024UL)
+
+// Feedback mask of the Galois LFSR
+#define FILL_LFSR_TAPS			0x80200003
+
+/*
+* Patterns
+*/
+typedef enum
+{
+	FILL_CONST = 0,
+	FILL_INC,
+	FILL_WALK,
+	FILL_LFSR
+} fillPattern_t;
+
+/*
+* Generator of a pattern (the state continues over the chunks)
+*/
+typedef struct
+{
+	fillPattern_t pattern;
+	uint32_t value;					// const: value, inc: start, lfsr: state
+	uint64_t index;					// index of the next word
+} fillGen_t;
+
+/*
+*   @brief               Read a pattern name ("const", "inc", "walk", "lfsr")
+*   @return              is Valid
+*/
+bool fillParsePattern(const char* name, fillPattern_t* pattern);
+
+/*
+*   @brief               Start a pattern
+*   @param	gen			 generator
+*   @param	pattern		 pattern
+*   @param	value		 value, start value or seed (the LFSR seed must not be 0)
+*/
+void fillGenInit(fillGen_t* gen, fillPattern_t pattern, uint32_t value);
+
+/*
+*   @brief               Generate the next words of the pattern
+*/
+void fillGenNext(fillGen_t* gen, uint32_t* dst, size_t words);
+
+/*
+*   @brief               Write a pattern to a device memory range
+*   @param	address		 physical start address (aligned to the store width)
+*   @param	length		 number of bytes (multiple of the store width in bytes)
+*   @param	width		 store width in bits (32, 64 or 128)
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int fillRange(uint32_t address, size_t length, fillPattern_t pattern, uint32_t value, uint8_t width);
+
+/*
+*   @brief               Compare a device memory range with a pattern
+*   @param	address		 physical start address (32-bit aligned)
+*   @param	length		 number of bytes (multiple of 4)
+*	@param	printAll	 print every mismatch, else only the first one
+*	@param	ConsloeOutput Print the mismatches to the console
+*   @param	mismatches	 number of mismatching words
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int verifyRange(uint32_t address, size_t length, fillPattern_t pattern, uint32_t value, \
+	bool printAll, bool ConsloeOutput, uint64_t* mismatches);
+
+#endif // FILL_PATTERN_H
@@ -15,14 +15,29 @@
  * 			GPO Mode and updated design
  * 		1.11 (03-14-2022)
  * 			Bug fix of writing to POSIX I/O
+ * 		1.20 (10-16-2026)
+ * 			Batch Script Mode with many commands per invocation
+ * 		1.30 (10-16-2026)
+ * 			Register access over the rstoolsd daemon (one batch per script part)
+ * 		1.40 (10-16-2026)
+ * 			Symbolic register names and field writes
+ * 		1.50 (10-16-2026)
+ * 			Range fill with patterns and verify pass
+ * 		1.60 (10-16-2026)
+ * 			Upload of a file or stdin into a range
+ * 		1.70 (10-16-2026)
+ * 			64-bit and 128-bit stores of the range fill
+ * 		1.80 (10-16-2026)
+ * 			Store width of the upload and throughput per width
  * 
  * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
  * 
  */
 
-#define VERSION "1.10"
+#define VERSION "1.80"
 
 #include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>					// POSIX: for acessing Linux drivers
 #include <sys/mman.h>				// POSIX: memory maping
@@ -32,33 +47,23 @@
 #include <thread>					// Required for putting task to sleep 
 #include <chrono>					// Required for putting task to sleep 
 #include <sstream>
+#include <vector>
 #include <cstdint>                  // Standard integral types (uint8_t,...)
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_client.h"			// rstoolsd daemon
+#include "rstools_regs.h"			// rstools register database
+#include "rstools_time.h"			// rstools timestamps
+#include "fill_pattern.h"			// range fill and verify
+#include "rstools_block.h"			// rstools block transfers
+#include <sys/stat.h>				// POSIX: fstat
+#include <cerrno>
+#include <cstring>
 using namespace std;
 
 #define DEC_INPUT 1
 #define HEX_INPUT 0
 #define BIN_INPUT 2
 
-// Bridge Interfaces Base addresses 
-#define LWHPSFPGA_OFST  0xff200000 	// LWHPS2FPGA Bridge 
-#define HPSFPGA_OFST    0xC0000000 	// HPS2FPGA Bridge 
-#define MPU_OFSET		0x0        	// MPU (HPS Address space)
-
-#define FPGAMAN_GPO_OFST    0xFF706010
-
-// Bridge interface End address 
-#define LWHPSFPGA_END   0xFF3FFFFF
-#define HPSFPGA_END     0xFBFFFFFF
-#define MPU_END         0xFFFFFFFF
-
-// Bridge interface range (allowed input offset)
-#define LWH2F_RANGE    (LWHPSFPGA_END - LWHPSFPGA_OFST)
-#define H2F_RANGE      (HPSFPGA_END - HPSFPGA_OFST)
-#define MPU_RANGE      (MPU_END - MPU_OFSET)
-
-#define MAP_SIZE 4096UL
-#define MAP_MASK (MAP_SIZE - 1)
-
 /*
 *	@param	Check that the Input is a valid HEX or DEC String
 *   @param  input 		String to check
@@ -87,6 +92,722 @@ bool checkIfInputIsVailed(std::string input, bool DecHex)
 	return false;
 }
 
+/*
+* Batch Script Mode
+*/
+
+#define SCRIPT_CMD_WRITE	0		// w    <space> <offset> <value>
+#define SCRIPT_CMD_SET		1		// set  <space> <offset> <bit pos>
+#define SCRIPT_CMD_CLEAR	2		// clr  <space> <offset> <bit pos>
+#define SCRIPT_CMD_READ		3		// r    <space> <offset>
+#define SCRIPT_CMD_POLL		4		// poll <space> <offset> <mask> <value> [timeout ms]
+
+#define SCRIPT_POLL_TIMEOUT_MS	1000	// Default timeout of the poll command
+
+typedef struct
+{
+	uint8_t  cmd;
+	uint32_t address;
+	uint32_t value;
+	uint32_t mask;
+	uint32_t timeout_ms;
+	uint32_t line;
+} scriptCmd_t;
+
+/*
+*	@brief	Parse a value of a script
+*   @param  input 		String to parse
+*   @param  hexOnly		True  ==> HEX with optional "0x" prefix (Offsets)
+*   					False ==> DEC or with "0x" prefix HEX (Values)
+*   @param  value		parsed value 
+*	@return is Valid
+*/
+bool parseScriptValue(const std::string& input, bool hexOnly, uint32_t* value)
+{
+	bool hasPrefix = (input.compare(0, 2, "0x") == 0) || (input.compare(0, 2, "0X") == 0);
+	bool isHex = hexOnly || hasPrefix;
+	std::string digits = hasPrefix ? input.substr(2) : input;
+
+	if ((digits.length() < 1) || (digits.length() > 20) || \
+		(digits.find_first_not_of(isHex ? "0123456789abcdefABCDEF" : "0123456789") != std::string::npos))
+		return false;
+
+	uint64_t temp = strtoull(digits.c_str(), nullptr, isHex ? 16 : 10);
+	if (temp > UINT32_MAX) return false;
+	*value = (uint32_t) temp;
+	return true;
+}
+
+/*
+*	@brief	Parse a script into a list of commands
+*			Every line contains one command, "#" starts a comment
+*			For "gpo" and "gpi" the offset is omitted, "gpi" is only valid for "r" and "poll"
+*			For "gpo" and "gpi" the offset is omitted
+*   @param  script 		script input stream
+*   @param  cmds		list of parsed commands
+*   @param  errorLine	line number of the first invalid line
+*	@return is Valid
+*/
+bool parseScript(std::istream& script, std::vector<scriptCmd_t>& cmds, uint32_t* errorLine)
+{
+	std::string lineStr;
+	uint32_t lineNo = 0;
+
+	while (std::getline(script, lineStr))
+	{
+		lineNo++;
+		*errorLine = lineNo;
+
+		// Remove the comment 
+		size_t comment = lineStr.find('#');
+		if (comment != std::string::npos) lineStr.erase(comment);
+
+		istringstream lineStream(lineStr);
+		std::vector<std::string> tokens;
+		std::string token;
+		while (lineStream >> token) tokens.push_back(token);
+		if (tokens.size() == 0) continue;
+
+		scriptCmd_t cmd;
+		cmd.line 		= lineNo;
+		cmd.value 		= 0;
+		cmd.mask 		= 0;
+		cmd.timeout_ms 	= SCRIPT_POLL_TIMEOUT_MS;
+
+		uint8_t argCount;
+		if 		(tokens[0] == "w")		{ cmd.cmd = SCRIPT_CMD_WRITE; argCount = 1; }
+		else if (tokens[0] == "set")	{ cmd.cmd = SCRIPT_CMD_SET;   argCount = 1; }
+		else if (tokens[0] == "clr")	{ cmd.cmd = SCRIPT_CMD_CLEAR; argCount = 1; }
+		else if (tokens[0] == "r")		{ cmd.cmd = SCRIPT_CMD_READ;  argCount = 0; }
+		else if (tokens[0] == "poll")	{ cmd.cmd = SCRIPT_CMD_POLL;  argCount = 2; }
+		else return false;
+
+		if (tokens.size() < 2) return false;
+		
+		// The GPO and GPI registers have no offset 
+		bool isGpi  = (tokens[1] == "gpi") || (tokens[1] == "-gpi");
+		bool isGpio = (tokens[1] == "gpo") || (tokens[1] == "-gpo") || isGpi;
+		// The GPI register is read-only
+		if (isGpi && (cmd.cmd != SCRIPT_CMD_READ) && (cmd.cmd != SCRIPT_CMD_POLL)) return false;
+		uint8_t argPos = isGpio ? 2 : 3;
+		uint32_t offset = 0;
+
+		if (!isGpio)
+		{
+			if ((tokens.size() < 3) || !parseScriptValue(tokens[2], true, &offset)) return false;
+		}
+		if (rsMemSpaceAddress(tokens[1].c_str(), offset, &cmd.address) != RSMEM_SUCCESS) return false;
+
+		// Check the number of arguments (only poll has an optional timeout)
+		if ((tokens.size() < (size_t)(argPos + argCount)) || \
+			(tokens.size() > (size_t)(argPos + argCount + (cmd.cmd == SCRIPT_CMD_POLL ? 1 : 0))))
+			return false;
+
+		switch (cmd.cmd)
+		{
+		case SCRIPT_CMD_WRITE:
+			if (!parseScriptValue(tokens[argPos], false, &cmd.value)) return false;
+			break;
+		case SCRIPT_CMD_SET:
+		case SCRIPT_CMD_CLEAR:
+			if (!parseScriptValue(tokens[argPos], false, &cmd.value) || (cmd.value > 31)) return false;
+			cmd.mask = (1u << cmd.value);
+			break;
+		case SCRIPT_CMD_POLL:
+			if (!parseScriptValue(tokens[argPos], false, &cmd.mask)) return false;
+			if (!parseScriptValue(tokens[argPos+1], false, &cmd.value)) return false;
+			if ((tokens.size() > (size_t)(argPos + 2)) && !parseScriptValue(tokens[argPos+2], false, &cmd.timeout_ms))
+				return false;
+			break;
+		default:
+			break;
+		}
+		cmds.push_back(cmd);
+	}
+	return true;
+}
+
+/*
+*	@brief	Print the value of a read command
+*/
+static void printScriptRead(uint32_t address, uint32_t value, bool ConsloeOutput)
+{
+	if (ConsloeOutput)
+		cout << "   Address 0x" << hex << address << ": " << dec << value << " [0x" << hex << value << "]" << dec << endl;
+	else
+		cout << value << endl;
+}
+
+/*
+*	@brief	Execute a parsed script over the rstoolsd daemon
+*			All commands between two poll commands are sent as one batch,
+*			the commands of a batch are executed also if one of them fails
+*   @param  cmds			list of commands
+*	@param	ConsloeOutput	Print Status Output to Console  	
+*	@return 1: success | -1: invalid address | -2: memory driver error | -3: poll timeout
+*/
+static int runScriptBatched(const std::vector<scriptCmd_t>& cmds, bool ConsloeOutput)
+{
+	std::vector<rsClientOp_t> ops;
+	size_t first = 0;
+	while (first < cmds.size())
+	{
+		// Collect the commands up to the next poll command
+		size_t last = first;
+		ops.clear();
+		for (; (last < cmds.size()) && (cmds[last].cmd != SCRIPT_CMD_POLL); last++)
+		{
+			const scriptCmd_t& cmd = cmds[last];
+			rsClientOp_t op = {};
+			op.req.address = cmd.address;
+			switch (cmd.cmd)
+			{
+			case SCRIPT_CMD_WRITE: op.req.op = RSPROTO_OP_WRITE; op.req.value = cmd.value; break;
+			case SCRIPT_CMD_SET:   op.req.op = RSPROTO_OP_SET;   op.req.value = cmd.mask;  break;
+			case SCRIPT_CMD_CLEAR: op.req.op = RSPROTO_OP_CLEAR; op.req.value = cmd.mask;  break;
+			default:               op.req.op = RSPROTO_OP_READ; break;
+			}
+			ops.push_back(op);
+		}
+
+		if (!ops.empty())
+		{
+			if (rsClientBatch(ops.data(), ops.size()) != RSMEM_SUCCESS)
+			{
+				if (ConsloeOutput)
+					cout << "[  ERROR  ] The connection to rstoolsd failed in line " << cmds[first].line << endl;
+				return RSMEM_ERR_DRIVER;
+			}
+			for (size_t i = 0; i < ops.size(); i++)
+			{
+				const scriptCmd_t& cmd = cmds[first + i];
+				if (ops[i].resp.status != RSMEM_SUCCESS)
+				{
+					if (ConsloeOutput)
+						cout << "[  ERROR  ] Accesing the virtual memory failed in line " << cmd.line << endl;
+					return ops[i].resp.status;
+				}
+				if (cmd.cmd == SCRIPT_CMD_READ)
+					printScriptRead(cmd.address, ops[i].resp.value, ConsloeOutput);
+			}
+		}
+
+		if (last < cmds.size())
+		{
+			const scriptCmd_t& cmd = cmds[last];
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(cmd.timeout_ms);
+			uint32_t value;
+			do
+			{
+				if (rsMemRead(cmd.address, &value) != RSMEM_SUCCESS)
+				{
+					if (ConsloeOutput)
+						cout << "[  ERROR  ] Accesing the virtual memory failed in line " << cmd.line << endl;
+					return RSMEM_ERR_DRIVER;
+				}
+				if ((value & cmd.mask) == cmd.value) break;
+				if (std::chrono::steady_clock::now() > deadline)
+				{
+					if (ConsloeOutput)
+						cout << "[  ERROR  ] Poll timeout in line " << cmd.line << " (Address 0x" << hex << cmd.address \
+							 << " = 0x" << value << ")" << dec << endl;
+					return -3;
+				}
+			} while (true);
+			last++;
+		}
+		first = last;
+	}
+	return RSMEM_SUCCESS;
+}
+
+/*
+*	@brief	Execute a parsed script over the cached memory windows or the rstoolsd daemon
+*   @param  cmds			list of commands
+*	@param	ConsloeOutput	Print Status Output to Console  	
+*	@return 1: success | -2: memory driver error | -3: poll timeout
+*/
+int runScript(const std::vector<scriptCmd_t>& cmds, bool ConsloeOutput)
+{
+	if (rsMemIsRemote())
+		return runScriptBatched(cmds, ConsloeOutput);
+
+	for (size_t i = 0; i < cmds.size(); i++)
+	{
+		const scriptCmd_t& cmd = cmds[i];
+		volatile uint32_t* reg = rsMemMap(cmd.address, 4);
+		if (reg == nullptr)
+		{
+			if (ConsloeOutput)
+				cout << "[  ERROR  ] Accesing the virtual memory failed in line " << cmd.line << endl;
+			return RSMEM_ERR_DRIVER;
+		}
+
+		switch (cmd.cmd)
+		{
+		case SCRIPT_CMD_WRITE:
+			*reg = cmd.value;
+			break;
+		case SCRIPT_CMD_SET:
+			*reg |= cmd.mask;
+			break;
+		case SCRIPT_CMD_CLEAR:
+			*reg &= ~cmd.mask;
+			break;
+		case SCRIPT_CMD_READ:
+			printScriptRead(cmd.address, *reg, ConsloeOutput);
+			break;
+		case SCRIPT_CMD_POLL:
+		{
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(cmd.timeout_ms);
+			while ((*reg & cmd.mask) != cmd.value)
+			{
+				if (std::chrono::steady_clock::now() > deadline)
+				{
+					if (ConsloeOutput)
+						cout << "[  ERROR  ] Poll timeout in line " << cmd.line << " (Address 0x" << hex << cmd.address \
+							 << " = 0x" << *reg << ")" << dec << endl;
+					return -3;
+				}
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+	return RSMEM_SUCCESS;
+}
+
+/*
+*	@brief	Read the store width of a range mode ("32", "64" or "128")
+*   @param  input 		argument
+*   @param  width		store width in bits
+*	@return is Valid
+*/
+static bool parseStoreWidth(const char* input, uint8_t* width)
+{
+	std::string arg = input;
+	if 		(arg == "32")  *width = RSBLOCK_WIDTH_32;
+	else if (arg == "64")  *width = RSBLOCK_WIDTH_64;
+	else if (arg == "128") *width = RSBLOCK_WIDTH_128;
+	else return false;
+	return true;
+}
+
+/*
+*	@brief	Check the store width for a range
+*			(the Lightweight Bridge only accepts 32-bit accesses)
+*	@return is Valid
+*/
+static bool storeWidthValid(const std::string& space, uint32_t address, uint64_t length, uint8_t width)
+{
+	if (width == RSBLOCK_WIDTH_32) return true;
+	return (space != "lw") && (address % (width / 8) == 0) && (length % (width / 8) == 0);
+}
+
+/*
+*	@brief	Fill a range with a pattern and/or verify it
+*			-fill lw|hf|mpu <Offset in HEX> <Length> const|inc|walk|lfsr [<Value>] [-v|-vo] [-all]
+*			[-width 32|64|128] [-b]
+*   @param  argc 		number of arguments
+*   @param  argv		arguments
+*	@param	ConsloeOutput	Print Status Output to Console
+*	@return 1: success | -1: input error | -2: memory driver error | -4: verify mismatch
+*/
+int runFill(int argc, const char* argv[], bool ConsloeOutput)
+{
+	fillPattern_t pattern = FILL_CONST;
+	uint32_t offset = 0;
+	uint32_t address = 0;
+	uint32_t value = 0;
+	uint64_t length = 0;
+	bool write = true;
+	bool verify = false;
+	bool printAll = false;
+	uint8_t width = RSBLOCK_WIDTH_32;
+
+	// Only the bridges and the MPU space are ranges (not gpo|gpi)
+	std::string space = (argc > 2) ? argv[2] : "";
+	if (space.compare(0, 1, "-") == 0) space.erase(0, 1);
+
+	bool InputVailed = (argc > 5) && ((space == "lw") || (space == "hf") || (space == "mpu")) && \
+		parseScriptValue(argv[3], true, &offset) && \
+		(rsMemSpaceAddress(space.c_str(), offset, &address) == RSMEM_SUCCESS) && \
+		(rsMemParseLength(argv[4], &length) == RSMEM_SUCCESS) && (length > 0) && (length % 4 == 0) && \
+		fillParsePattern(argv[5], &pattern);
+
+	// The LFSR must not start with 0 (it would stay 0)
+	if (pattern == FILL_LFSR) value = 1;
+
+	for (int i = 6; (i < argc) && InputVailed; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-v")
+			verify = true;
+		else if (arg == "-vo")
+		{
+			verify = true;
+			write = false;
+		}
+		else if (arg == "-all")
+			printAll = true;
+		else if ((arg == "-width") && (i + 1 < argc) && parseStoreWidth(argv[i + 1], &width))
+			i++;
+		else if (arg == "-b")
+			continue;
+		else if ((i != 6) || !parseScriptValue(arg, false, &value))
+			InputVailed = false;
+	}
+	if ((pattern == FILL_LFSR) && (value == 0)) InputVailed = false;
+	if (InputVailed) InputVailed = storeWidthValid(space, address, length, width);
+
+	// The whole range must be inside of the address space
+	uint32_t lastAddress = 0;
+	if (InputVailed)
+	{
+		InputVailed = (offset + length - 4 <= UINT32_MAX) && \
+			(rsMemSpaceAddress(space.c_str(), (uint32_t) (offset + length - 4), &lastAddress) == RSMEM_SUCCESS) && \
+			(lastAddress >= address);
+	}
+
+	if (!InputVailed)
+	{
+		if (ConsloeOutput)
+		{
+			cout << "[ ERROR ] User Input is wrong!"<<endl;
+			cout << "          FPGA-writeBridge -fill lw|hf|mpu <Offset in HEX> <Length> const|inc|walk|lfsr [<Value>]" << endl;
+			cout << "                           [-v|-vo] [-all] [-width 32|64|128] -b" << endl;
+		}
+		return RSMEM_ERR_INPUT;
+	}
+
+	if (ConsloeOutput)
+	{
+		cout << "------------------------------------FILLING------------------------------------------" << endl;
+		cout << "   Range:       0x" << hex << address << " - 0x" << lastAddress + 3 << dec << " (" << length << " Bytes)" << endl;
+		cout << "   Pattern:     " << argv[5];
+		if (pattern != FILL_WALK) cout << " 0x" << hex << value << dec;
+		cout << endl;
+		cout << "   Store width: " << (int) width << "-bit" << endl;
+	}
+
+	if (rsMemOpen() != RSMEM_SUCCESS)
+	{
+		if (ConsloeOutput)
+			cout << "ERROR: Failed to open memory driver!" << endl;
+		return RSMEM_ERR_DRIVER;
+	}
+
+	// Without rstoolsd the range is mapped once, the chunks are served from the cached window
+	if (!rsMemIsRemote() && (rsMemMap(address, (uint32_t) length) == nullptr))
+	{
+		if (ConsloeOutput)
+			cout << "ERROR: Accesing the virtual memory failed!" << endl;
+		rsMemClose();
+		return RSMEM_ERR_DRIVER;
+	}
+
+	if (write)
+	{
+		uint64_t start = rsTimeNowNs();
+		if (fillRange(address, length, pattern, value, width) != RSMEM_SUCCESS)
+		{
+			if (ConsloeOutput)
+				cout << "[  ERROR  ] Writing the range failed!" << endl;
+			rsMemClose();
+			return RSMEM_ERR_DRIVER;
+		}
+		uint64_t time_ns = rsTimeNowNs() - start;
+		if (ConsloeOutput)
+		{
+			cout << "[  INFO  ]  " << length << " Bytes written in " << time_ns / 1000 << " us with " \
+				 << (int) width << "-bit stores";
+			if (time_ns > 0) cout << " (" << (length * 1000) / time_ns << " MB/s)";
+			cout << endl;
+		}
+	}
+
+	uint64_t mismatches = 0;
+	if (verify)
+	{
+		if (verifyRange(address, length, pattern, value, printAll, ConsloeOutput, &mismatches) != RSMEM_SUCCESS)
+		{
+			if (ConsloeOutput)
+				cout << "[  ERROR  ] Reading the range failed!" << endl;
+			rsMemClose();
+			return RSMEM_ERR_DRIVER;
+		}
+		if (ConsloeOutput)
+		{
+			if (mismatches == 0)
+				cout << "[  INFO  ]  Verify: all " << length / 4 << " words match" << endl;
+			else
+				cout << "[  ERROR  ] Verify: " << mismatches << " of " << length / 4 << " words mismatch" << endl;
+		}
+	}
+	rsMemClose();
+
+	return (mismatches > 0) ? -4 : RSMEM_SUCCESS;
+}
+
+/*
+*	@brief	Read the source of an upload (a regular file is mapped, stdin or a pipe is read)
+*   @param  name 		file name or "-" for stdin
+*   @param  buffer		buffer for a source that can not be mapped
+*   @param  map			mapped file (for munmap) or nullptr
+*   @param  length		length of the source
+*	@return data or nullptr
+*/
+static const uint8_t* openUploadSource(const char* name, std::vector<uint8_t>& buffer, void** map, size_t* length)
+{
+	*map = nullptr;
+	int fd = (strcmp(name, "-") == 0) ? STDIN_FILENO : open(name, O_RDONLY);
+	if (fd < 0) return nullptr;
+
+	struct stat st;
+	if ((fstat(fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0))
+	{
+		*length = (size_t) st.st_size;
+		void* data = mmap(NULL, *length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (fd != STDIN_FILENO) close(fd);
+		if (data == MAP_FAILED) return nullptr;
+		*map = data;
+		return (const uint8_t*) data;
+	}
+
+	// Read the stream in chunks
+	buffer.clear();
+	uint8_t chunk[64*1024];
+	ssize_t res;
+	while ((res = read(fd, chunk, sizeof(chunk))) != 0)
+	{
+		if (res < 0)
+		{
+			if (errno == EINTR) continue;
+			buffer.clear();
+			break;
+		}
+		buffer.insert(buffer.end(), chunk, chunk + res);
+	}
+	if (fd != STDIN_FILENO) close(fd);
+	*length = buffer.size();
+	return (buffer.size() > 0) ? buffer.data() : nullptr;
+}
+
+/*
+*	@brief	Write the data of an upload with one store width
+*			(the words behind the last complete wide store are written with 32-bit
+*			stores, the last bytes are merged into the existing word)
+*   @param  address 	physical start address (aligned to the store width)
+*   @param  data		data of the upload
+*   @param  length		bytes of the upload
+*   @param  width		store width in bits
+*	@return RSMEM_SUCCESS or an error code of rsMemWriteBlock
+*/
+static int uploadWrite(uint32_t address, const uint8_t* data, size_t length, uint8_t width)
+{
+	size_t wide = length - length % (width / 8);
+	size_t words = length / 4;
+	size_t tail = length % 4;
+	int res = RSMEM_SUCCESS;
+
+	if (wide > 0)
+		res = rsMemWriteBlock(address, data, (uint32_t) wide, width);
+	if ((res == RSMEM_SUCCESS) && (words * 4 > wide))
+		res = rsMemWriteBlock(address + (uint32_t) wide, data + wide, (uint32_t) (words * 4 - wide));
+	// A word is the smallest access of the bridges, the other bytes keep their value
+	if ((res == RSMEM_SUCCESS) && (tail > 0))
+	{
+		uint32_t last = 0;
+		res = rsMemRead(address + (uint32_t) (words * 4), &last);
+		memcpy(&last, data + words * 4, tail);
+		if (res == RSMEM_SUCCESS)
+			res = rsMemWrite(address + (uint32_t) (words * 4), last);
+	}
+	return res;
+}
+
+/*
+*	@brief	Upload a file or stdin into a range and verify it
+*			-upload lw|hf|mpu <Offset in HEX> <File|-> [-v] [-width 32|64|128|all] [-b]
+*			"all" writes the file once with every store width of the range
+*   @param  argc 		number of arguments
+*   @param  argv		arguments
+*	@param	ConsloeOutput	Print Status Output to Console
+*	@return 1: success | -1: input error | -2: memory driver error | -4: verify mismatch
+*/
+int runUpload(int argc, const char* argv[], bool ConsloeOutput)
+{
+	std::string space = (argc > 2) ? argv[2] : "";
+	if (space.compare(0, 1, "-") == 0) space.erase(0, 1);
+	uint32_t offset = 0;
+	uint32_t address = 0;
+	bool verify = false;
+	bool allWidths = false;
+	uint8_t width = RSBLOCK_WIDTH_32;
+
+	bool InputVailed = (argc > 4) && ((space == "lw") || (space == "hf") || (space == "mpu")) && \
+		parseScriptValue(argv[3], true, &offset) && \
+		(rsMemSpaceAddress(space.c_str(), offset, &address) == RSMEM_SUCCESS);
+	for (int i = 5; (i < argc) && InputVailed; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-v")
+			verify = true;
+		else if ((arg == "-width") && (i + 1 < argc) && (std::string(argv[i + 1]) == "all"))
+		{
+			allWidths = true;
+			i++;
+		}
+		else if ((arg == "-width") && (i + 1 < argc) && parseStoreWidth(argv[i + 1], &width))
+			i++;
+		else if (arg != "-b")
+			InputVailed = false;
+	}
+	// The tail behind the last wide store is written with 32-bit stores
+	if (InputVailed) InputVailed = storeWidthValid(space, address, 0, width);
+
+	std::vector<uint8_t> buffer;
+	void* map = nullptr;
+	size_t length = 0;
+	const uint8_t* data = nullptr;
+	if (InputVailed)
+	{
+		data = openUploadSource(argv[4], buffer, &map, &length);
+		if (data == nullptr)
+		{
+			if (ConsloeOutput)
+				cout << "[  ERROR  ] The selected file does not exist or is empty!" << endl;
+			return RSMEM_ERR_INPUT;
+		}
+	}
+
+	// The whole file must fit into the address space
+	uint32_t lastAddress = 0;
+	if (InputVailed)
+	{
+		uint64_t lastOffset = (uint64_t) offset + ((length + 3) & ~(size_t) 3) - 4;
+		InputVailed = (lastOffset <= UINT32_MAX) && \
+			(rsMemSpaceAddress(space.c_str(), (uint32_t) lastOffset, &lastAddress) == RSMEM_SUCCESS) && \
+			(lastAddress >= address);
+	}
+
+	if (!InputVailed)
+	{
+		if (map != nullptr) munmap(map, length);
+		if (ConsloeOutput)
+		{
+			cout << "[ ERROR ] User Input is wrong!"<<endl;
+			cout << "          FPGA-writeBridge -upload lw|hf|mpu <Offset in HEX> <File|- for stdin> [-v]" << endl;
+			cout << "                           [-width 32|64|128|all] -b" << endl;
+		}
+		return RSMEM_ERR_INPUT;
+	}
+
+	if (ConsloeOutput)
+	{
+		cout << "-----------------------------------UPLOADING-----------------------------------------" << endl;
+		cout << "   Source:      " << ((strcmp(argv[4], "-") == 0) ? "stdin" : argv[4]) << " (" << length << " Bytes)" << endl;
+		cout << "   Range:       0x" << hex << address << " - 0x" << lastAddress + 3 << dec << endl;
+	}
+
+	// Without rstoolsd the range is mapped once, the block accesses are served from the cached window
+	int res = rsMemOpen();
+	if ((res == RSMEM_SUCCESS) && !rsMemIsRemote() && \
+		(rsMemMap(address, (uint32_t) ((length + 3) & ~(size_t) 3)) == nullptr))
+		res = RSMEM_ERR_DRIVER;
+	if (res != RSMEM_SUCCESS)
+	{
+		if (ConsloeOutput)
+			cout << "ERROR: Accesing the virtual memory failed!" << endl;
+		if (map != nullptr) munmap(map, length);
+		rsMemClose();
+		return RSMEM_ERR_DRIVER;
+	}
+
+	// With "all" every store width that is valid for the range writes the file once
+	std::vector<uint8_t> widths;
+	if (allWidths)
+	{
+		for (uint8_t w : { RSBLOCK_WIDTH_32, RSBLOCK_WIDTH_64, RSBLOCK_WIDTH_128 })
+			if (storeWidthValid(space, address, 0, w)) widths.push_back(w);
+	}
+	else
+		widths.push_back(width);
+
+	uint64_t time_ns = 0;
+	for (uint8_t w : widths)
+	{
+		uint64_t start = rsTimeNowNs();
+		res = uploadWrite(address, data, length, w);
+		time_ns = rsTimeNowNs() - start;
+		if (res != RSMEM_SUCCESS)
+		{
+			if (ConsloeOutput)
+				cout << "[  ERROR  ] Writing the range failed!" << endl;
+			if (map != nullptr) munmap(map, length);
+			rsMemClose();
+			return RSMEM_ERR_DRIVER;
+		}
+
+		if (ConsloeOutput)
+		{
+			cout << "[  INFO  ]  " << length << " Bytes written in " << time_ns / 1000 << " us with " \
+				 << (int) w << "-bit stores";
+			if (time_ns > 0) cout << " (" << (length * 1000) / time_ns << " MB/s)";
+			cout << endl;
+		}
+	}
+
+	uint64_t mismatches = 0;
+	if (verify)
+	{
+		std::vector<uint32_t> read(RSBLOCK_CHUNK_SIZE / 4 + 1);
+		uint64_t start = rsTimeNowNs();
+		for (size_t pos = 0; pos < length; pos += RSBLOCK_CHUNK_SIZE)
+		{
+			size_t len = min((size_t) RSBLOCK_CHUNK_SIZE, length - pos);
+			res = rsMemReadBlock(address + (uint32_t) pos, read.data(), (uint32_t) ((len + 3) & ~(size_t) 3));
+			if (res != RSMEM_SUCCESS) break;
+
+			const uint8_t* got = (const uint8_t*) read.data();
+			if (memcmp(got, data + pos, len) == 0) continue;
+			for (size_t i = 0; i < len; i++)
+			{
+				if (got[i] == data[pos + i]) continue;
+				if (ConsloeOutput && (mismatches == 0))
+				{
+					char line[96];
+					snprintf(line, sizeof(line), "   Mismatch at 0x%08x: expected 0x%02x read 0x%02x", \
+						address + (uint32_t) (pos + i), data[pos + i], got[i]);
+					cout << line << endl;
+				}
+				mismatches++;
+			}
+		}
+		time_ns = rsTimeNowNs() - start;
+
+		if (ConsloeOutput)
+		{
+			if (res != RSMEM_SUCCESS)
+				cout << "[  ERROR  ] Reading the range failed!" << endl;
+			else if (mismatches == 0)
+			{
+				cout << "[  INFO  ]  Verify: all " << length << " Bytes match (" << time_ns / 1000 << " us";
+				if (time_ns > 0) cout << ", " << (length * 1000) / time_ns << " MB/s";
+				cout << ")" << endl;
+			}
+			else
+				cout << "[  ERROR  ] Verify: " << mismatches << " of " << length << " Bytes mismatch" << endl;
+		}
+	}
+
+	if (map != nullptr) munmap(map, length);
+	rsMemClose();
+	if (res != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+	return (mismatches > 0) ? -4 : RSMEM_SUCCESS;
+}
 
 int main(int argc, const char* argv[])
 {
@@ -104,6 +825,149 @@ int main(int argc, const char* argv[])
 	//argv[5] = (const char*)"0";  // Bit Set
 	//argc = 5;
 	
+	// Batch Script Mode: execute many commands over one cached mapping
+	if ((argc > 2) && (std::string(argv[1]) == "-s"))
+	{
+		bool ConsloeOutput = !((argc > 3) && (std::string(argv[3]) == "-b"));
+		std::vector<scriptCmd_t> cmds;
+		uint32_t errorLine = 0;
+		bool InputVailed;
+
+		// Read the script from the file or from stdin  
+		if (std::string(argv[2]) == "-")
+			InputVailed = parseScript(cin, cmds, &errorLine);
+		else
+		{
+			ifstream scriptFile(argv[2]);
+			if (!scriptFile.good())
+			{
+				if (ConsloeOutput)
+					cout << "[  ERROR  ] The selected script file does not exist!" << endl;
+				else
+					cout << -1;
+				return 0;
+			}
+			InputVailed = parseScript(scriptFile, cmds, &errorLine);
+		}
+
+		if (!InputVailed)
+		{
+			if (ConsloeOutput)
+			{
+				cout << "[  ERROR  ] Script line " << errorLine << " is not vailed! Nothing was written." << endl;
+				cout << "            w|set|clr|r|poll lw|hf|mpu|gpo <offset in hex> <value|bit pos|mask value [timeout ms]>" << endl;
+			}
+			else
+				cout << -1;
+			return 0;
+		}
+
+		int res = rsMemOpen();
+		if (res == RSMEM_SUCCESS)
+			res = runScript(cmds, ConsloeOutput);
+		else if (ConsloeOutput)
+			cout << "ERROR: Failed to open memory driver!" << endl;
+
+		rsMemClose();
+
+		if (ConsloeOutput)
+		{
+			if (res == RSMEM_SUCCESS)
+				cout << "[  INFO  ]  Script with " << cmds.size() << " commands executed successful " << endl;
+		}
+		else
+			cout << res;
+		return 0;
+	}
+
+	// Fill a range with a pattern and verify it
+	if ((argc > 1) && (std::string(argv[1]) == "-fill"))
+	{
+		bool ConsloeOutput = (std::string(argv[argc-1]) != "-b");
+		int res = runFill(argc, argv, ConsloeOutput);
+		if (!ConsloeOutput)
+			cout << res;
+		return 0;
+	}
+
+	// Upload a file or stdin into a range
+	if ((argc > 1) && (std::string(argv[1]) == "-upload"))
+	{
+		bool ConsloeOutput = (std::string(argv[argc-1]) != "-b");
+		int res = runUpload(argc, argv, ConsloeOutput);
+		if (!ConsloeOutput)
+			cout << res;
+		return 0;
+	}
+
+	// Write a register or a field of the register database by its name
+	if ((argc > 3) && (std::string(argv[1]) == "-reg"))
+	{
+		bool ConsloeOutput = !((argc > 4) && (std::string(argv[4]) == "-b"));
+		const rsReg_t* reg;
+		const rsRegField_t* field;
+		uint32_t value = 0;
+
+		bool InputVailed = (rsRegParse(argv[2], &reg, &field) == RSMEM_SUCCESS) && \
+			parseScriptValue(argv[3], false, &value);
+		// The value must fit into the field
+		if (InputVailed && (field != nullptr) && (field->width < 32) && (value >> field->width))
+			InputVailed = false;
+
+		if (!InputVailed)
+		{
+			if (ConsloeOutput)
+			{
+				cout << "[ ERROR ] User Input is wrong!"<<endl;
+				cout << "          FPGA-writeBridge -reg <Register>[.<Field>] <Value DEC or HEX with 0x> -b" << endl;
+			}
+			else
+				cout << -1;
+			return 0;
+		}
+
+		if (ConsloeOutput)
+		{
+			cout << "------------------------------------WRITING------------------------------------------" << endl;
+			cout << "   Register:    " << reg->name;
+			if (field != nullptr) cout << "." << field->name;
+			cout << "      Address:  0x" << hex << reg->address << dec << endl;
+			cout << "   Value:       " << value << hex << " [0x" << value << "]" << dec << endl;
+		}
+
+		int res = rsMemOpen();
+		uint32_t oldValue = 0;
+
+		// A field is written with read-modify-write of the register,
+		// the whole register is only read for the console output
+		if ((res == RSMEM_SUCCESS) && ((field != nullptr) || ConsloeOutput))
+		{
+			res = rsMemRead(reg->address, &oldValue);
+			if ((res == RSMEM_SUCCESS) && ConsloeOutput)
+				cout << "   old Value:   " << oldValue << " [0x" << hex << oldValue << "]" << dec << endl;
+		}
+		if (res == RSMEM_SUCCESS)
+		{
+			if (field != nullptr)
+				value = (oldValue & ~rsRegFieldMask(field)) | (value << field->lsb);
+			res = rsMemWrite(reg->address, value);
+		}
+		rsMemClose();
+
+		if (res != RSMEM_SUCCESS)
+		{
+			if (ConsloeOutput)
+				cout << "ERROR: Accesing the virtual memory failed!" << endl;
+			else
+				cout << -2;
+		}
+		else if (ConsloeOutput)
+			cout << "[  INFO  ]  Writing was successful " << endl;
+		else
+			cout << 1;
+		return 0;
+	}
+
 	// Read to the Light Wightweight or AXI HPS to FPGA Interface
 	if (((argc > 3) && (std::string(argv[1]) == "-lw"))  || ((argc > 3) && (std::string(argv[1]) == "-hf"))|| \
 	    ((argc > 3) && (std::string(argv[1]) == "-mpu")) || ((argc > 1) && (std::string(argv[1]) == "-gpo")))
@@ -353,14 +1217,8 @@ int main(int argc, const char* argv[])
 			}
 			do
 			{
-				void* bridgeMap;
-				int fd;
-
 				// open memory driver 
-				fd = open("/dev/mem", (O_RDWR | O_SYNC));
-
-				// was opening okay
-				if (fd < 0)
+				if (rsMemOpen() != RSMEM_SUCCESS)
 				{
 					if (ConsloeOutput)
 						cout << "ERROR: Failed to open memory driver!" << endl;
@@ -369,56 +1227,38 @@ int main(int argc, const char* argv[])
 					break;
 				}
 
-				// configure a virtual memory interface to the bridge or mpu
-				bridgeMap = mmap(NULL, MAP_SIZE, PROT_WRITE|PROT_READ, MAP_SHARED, fd, \
-					address & ~MAP_MASK);
-
-				// check if opening was sucsessful
-				if (bridgeMap == MAP_FAILED)
-				{
-					if (ConsloeOutput)
-						cout << "ERROR: Accesing the virtual memory failed!" << endl;
-					else
-						cout << -2;
-					close(fd);
-					return 0;
-				}
-
-				// access to Bridge is okay 
-				// write the value to the address 
-
-				uint16_t delay_count = 0;
-				uint32_t* ptrmap = (uint32_t*)(bridgeMap +(address & MAP_MASK));
 				// print also the old value of the selected register
+				// (a read can have side effects, it is only done for the console output)
+				int res = RSMEM_SUCCESS;
 				if (ConsloeOutput)
 				{
-					cout << "   old Value:   " << *ptrmap << " [0x" << hex << *ptrmap << "]" << dec << endl;
+					uint32_t oldValue = 0;
+					res = rsMemRead(address, &oldValue);
+					if (res == RSMEM_SUCCESS)
+						cout << "   old Value:   " << oldValue << " [0x" << hex << oldValue << "]" << dec << endl;
 				}
 
-				// write the value to the address 
-
 				// write the new value to the selected register
-				
-				if (DecHexBin == BIN_INPUT)
+				if ((res == RSMEM_SUCCESS) && (DecHexBin == BIN_INPUT))
 				{
-					if (SetResetBit) *ptrmap |=  (1 << BitPosValue);
-					else			 *ptrmap &= ~(1 << BitPosValue);
+					if (SetResetBit) res = rsMemSetBits(address, (1u << BitPosValue));
+					else			 res = rsMemClearBits(address, (1u << BitPosValue));
 				}
-				else
-					*ptrmap = ValueInput;
-				
+				else if (res == RSMEM_SUCCESS)
+					res = rsMemWrite(address, ValueInput);
 
-				// Close the MAP 
-				if (munmap(bridgeMap, MAP_SIZE) < 0)
+				if (res != RSMEM_SUCCESS)
 				{
 					if (ConsloeOutput)
-						cout << "[ ERROR ] Closing of shared memory failed!" << endl;
-						else cout << -2;
+						cout << "ERROR: Accesing the virtual memory failed!" << endl;
+					else
+						cout << -2;
+					rsMemClose();
+					return 0;
 				}
-			
 
-				// close the driver port 
-				close(fd);
+				// Close the MAP and the driver port 
+				rsMemClose();
 
 				if (ConsloeOutput)
 					cout << "[  INFO  ]  Writing was successful " << endl;
@@ -476,6 +1316,35 @@ int main(int argc, const char* argv[])
 		cout << "|$ FPGA-writeBridge -lw|hf|mpu| <offset address in hex>                                      |" << endl;
 		cout << "|                       -h|-b|<value dec> <value hex>|<bit pos> <bit value>  -b              |" << endl;
 		cout << "|$ FPGA-writeBridge -gpo -h|-b|<value dec> <value hex>|<bit pos> <bit value>  -b             |" << endl;
+		cout << "|$ FPGA-writeBridge -s [Script File|- for stdin] -b                                          |" << endl;
+		cout << "|      L   Batch Mode: execute a script with one command per line                            |" << endl;
+		cout << "|             w    lw|hf|mpu|gpo <Offset in HEX> <Value>                                     |" << endl;
+		cout << "|             set  lw|hf|mpu|gpo <Offset in HEX> <Bit Pos>                                   |" << endl;
+		cout << "|             clr  lw|hf|mpu|gpo <Offset in HEX> <Bit Pos>                                   |" << endl;
+		cout << "|             r    lw|hf|mpu|gpo|gpi <Offset in HEX>                                         |" << endl;
+		cout << "|             poll lw|hf|mpu|gpo|gpi <Offset in HEX> <Mask> <Value> [Timeout ms]             |" << endl;
+		cout << "|          Values in DEC or HEX with 0x, no Offset for gpo|gpi, # for comments               |" << endl;
+		cout << "|          e.g.: FPGA-writeBridge -s bringup.txt                                             |" << endl;
+		cout << "|                     L -3 = Poll Timeout                                                    |" << endl;
+		cout << "|$ FPGA-writeBridge -reg <Register>[.<Field>] <Value in DEC or HEX with 0x> -b               |" << endl;
+		cout << "|      L   Write a HPS register by its name (hps.h without \"ALT_\"), a field is written       |" << endl;
+		cout << "|          with read-modify-write of the register (list: FPGA-readBridge -reg list)          |" << endl;
+		cout << "|          e.g.: FPGA-writeBridge -reg RSTMGR_BRGMODRST.LWHPS2FPGA 0                         |" << endl;
+		cout << "|$ FPGA-writeBridge -fill lw|hf|mpu <Offset in HEX> <Length> <Pattern> [<Value>] [-v|-vo] -b |" << endl;
+		cout << "|      L   Fill a range (mapped once) with a pattern, Length in DEC with K|M or HEX with 0x  |" << endl;
+		cout << "|          Pattern: const <Value> | inc <Start> | walk (walking ones) | lfsr <Seed>          |" << endl;
+		cout << "|          -v verifies the range after the fill, -vo only verifies it (memory test)          |" << endl;
+		cout << "|          -all prints all mismatches instead of the first one                               |" << endl;
+		cout << "|          -width 32|64|128 store width of hf|mpu ranges (default 32, lw: only 32), the      |" << endl;
+		cout << "|          range must be aligned to the width, 128-bit stores use NEON on ARM                |" << endl;
+		cout << "|                     L -4 = Verify Mismatch                                                 |" << endl;
+		cout << "|          e.g.: FPGA-writeBridge -fill hf 0 64K lfsr 0x1234 -v                              |" << endl;
+		cout << "|$ FPGA-writeBridge -upload lw|hf|mpu <Offset in HEX> <File|- for stdin> [-v] [-width] -b    |" << endl;
+		cout << "|      L   Copy a binary file (e.g. Nios II firmware) into a range, the file is mapped       |" << endl;
+		cout << "|          -v reads the range back and compares it with the file, -4 = Verify Mismatch       |" << endl;
+		cout << "|          -width 32|64|128 store width like -fill (only the offset must be aligned),        |" << endl;
+		cout << "|          -width all writes the file with every width and reports the MB/s of each          |" << endl;
+		cout << "|          e.g.: FPGA-writeBridge -upload hf 0 firmware.bin -v                               |" << endl;
 		cout << "----------------------------------------------------------------------------------------------" << endl;
 		cout << "| Vers.: "<<VERSION<<"                                                                                |"<<endl;
 		cout << "| Copyright (C) 2020-2022 rsyocto GmbH & Co. KG                                              |" << endl;
@@ -42,6 +42,10 @@
 #include <stdbool.h>
 #include "hwlib.h"
 #include "alt_printf.h"
+#ifdef LINUX_TASK_MODE
+#include <time.h>
+#include <sched.h>
+#endif
 
 
 #ifdef DEBUG_ALT_FPGA_MANAGER
@@ -50,15 +54,29 @@
   #define dprintf  null_printf
 #endif
 
+/* The timeouts are wall-clock deadlines in us. Without an operating system
+ * clock (bare-metal) they are used as number of polling cycles. */
+
 /* This is the timeout used when waiting for a state change in the FPGA monitor. */
-#define _ALT_FPGA_TMO_STATE     2048
+#define _ALT_FPGA_TMO_STATE_US      100000
 
 /* This is the timeout used when waiting for the DCLK countdown to complete.
- * The time to wait a constant + DCLK * multiplier. */
-#define _ALT_FPGA_TMO_DCLK_CONST 2048
-#define _ALT_FPGA_TMO_DCLK_MUL   2
-
-#define _ALT_FPGA_TMO_CONFIG     8192
+ * The time to wait a constant + DCLK * multiplier (DCLK >= 1 MHz). */
+#define _ALT_FPGA_TMO_DCLK_CONST_US 10000
+#define _ALT_FPGA_TMO_DCLK_MUL_US   1
+
+/* This is the timeout used when waiting for CONF_DONE after the data. */
+#define _ALT_FPGA_TMO_CONFIG_US     1000000
+
+/* Backoff of the polling loops: poll without pause for the first
+ * _ALT_FPGA_POLL_SPIN_US, then give the core away with sched_yield() until
+ * _ALT_FPGA_POLL_YIELD_US, then sleep with a doubling time of up to
+ * _ALT_FPGA_POLL_SLEEP_MAX_US. Short waits keep their latency, long waits
+ * free the core for other tasks. */
+#define _ALT_FPGA_POLL_SPIN_US      50
+#define _ALT_FPGA_POLL_YIELD_US     1000
+#define _ALT_FPGA_POLL_SLEEP_MIN_US 20
+#define _ALT_FPGA_POLL_SLEEP_MAX_US 1000
 
 /* This define is used to control whether to use the Configuration with DCLK steps */
 #ifndef _ALT_FPGA_USE_DCLK
@@ -66,19 +84,23 @@
 #endif
 
 /* This is used in the FPGA reconfiguration streaming interface. Because FPGA
- * images are commonly stored on disk, the chunk size is that of the disk size.
- * We cannot choose too large a chunk size because the stack size is fairly
- * small. */
+ * images are commonly stored on disk, the chunk size is a multiple of the disk
+ * size. Under Linux a chunk of 512 bytes costs one system call per sector, so
+ * a larger chunk is used. The chunk buffer is static, because the stack of
+ * bare-metal applications is fairly small. */
 #define DISK_SECTOR_SIZE    512
-#define ISTREAM_CHUNK_SIZE  DISK_SECTOR_SIZE
+#ifndef ISTREAM_CHUNK_SIZE
+#define ISTREAM_CHUNK_SIZE  (128 * DISK_SECTOR_SIZE)
+#endif
 
 /*
  * FPGA Data Type identifier enum
 */
 typedef enum FPGA_DATA_TYPE_e
 {
-    FPGA_DATA_FULL    = 1,
-    FPGA_DATA_ISTREAM = 2
+    FPGA_DATA_FULL        = 1,
+    FPGA_DATA_ISTREAM     = 2,
+    FPGA_DATA_ISTREAM_MAP = 3
 } FPGA_DATA_TYPE_t;
 
 /*
@@ -103,6 +125,13 @@ typedef struct FPGA_DATA_s
             alt_fpga_istream_t stream;
             void *             data;
         } istream;
+
+        /* FPGA_DATA_ISTREAM_MAP */
+        struct
+        {
+            alt_fpga_istream_map_t stream;
+            void *                 data;
+        } istream_map;
     } mode;
 
 #if ALT_FPGA_ENABLE_DMA_SUPPORT
@@ -112,6 +141,134 @@ typedef struct FPGA_DATA_s
 
 } FPGA_DATA_t;
 
+/*
+ * Timing record of the configuration (NULL: no trace).
+*/
+static ALT_FPGA_TRACE_t * alt_fpga_trace = NULL;
+
+/*
+ * Monotonic time in ns for the trace (0 without an operating system clock).
+*/
+static uint64_t alt_fpga_trace_now(void)
+{
+#ifdef LINUX_TASK_MODE
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * State of one polling loop with deadline and backoff.
+*/
+typedef struct ALT_FPGA_POLL_s
+{
+    ALT_FPGA_WAIT_t wait;       /* Kind of the wait for the statistics. */
+    uint64_t start;             /* Start time in ns. */
+    uint64_t now;               /* Time of the last poll in ns. */
+    uint64_t deadline;          /* Deadline in ns (or remaining polling cycles). */
+    uint32_t sleep_us;          /* Current sleep time of the backoff. */
+    uint64_t iterations;
+    uint64_t yields;
+    uint64_t sleeps;
+} ALT_FPGA_POLL_t;
+
+static void alt_fpga_poll_begin(ALT_FPGA_POLL_t * poll, ALT_FPGA_WAIT_t wait, uint32_t timeout_us)
+{
+    poll->wait       = wait;
+    poll->start      = alt_fpga_trace_now();
+    poll->now        = poll->start;
+    poll->sleep_us   = _ALT_FPGA_POLL_SLEEP_MIN_US;
+    poll->iterations = 0;
+    poll->yields     = 0;
+    poll->sleeps     = 0;
+#ifdef LINUX_TASK_MODE
+    poll->deadline   = poll->start + (uint64_t) timeout_us * 1000;
+#else
+    poll->deadline   = timeout_us;
+#endif
+}
+
+/*
+ * Helper function which waits before the next poll.
+ * Returns false if the deadline has passed.
+*/
+static bool alt_fpga_poll_next(ALT_FPGA_POLL_t * poll)
+{
+    poll->iterations++;
+
+#ifdef LINUX_TASK_MODE
+    poll->now = alt_fpga_trace_now();
+    if (poll->now >= poll->deadline)
+    {
+        return false;
+    }
+
+    uint64_t elapsed_us = (poll->now - poll->start) / 1000;
+    if (elapsed_us < _ALT_FPGA_POLL_SPIN_US)
+    {
+        /* Spin */
+    }
+    else if (elapsed_us < _ALT_FPGA_POLL_YIELD_US)
+    {
+        sched_yield();
+        poll->yields++;
+    }
+    else
+    {
+        struct timespec ts;
+        ts.tv_sec  = 0;
+        ts.tv_nsec = poll->sleep_us * 1000;
+        nanosleep(&ts, NULL);
+        poll->sleeps++;
+        if (poll->sleep_us < _ALT_FPGA_POLL_SLEEP_MAX_US)
+        {
+            poll->sleep_us *= 2;
+        }
+    }
+    return true;
+#else
+    return (poll->iterations <= poll->deadline);
+#endif
+}
+
+/*
+ * Helper function which adds a finished wait to the statistics of the trace.
+*/
+static void alt_fpga_poll_end(ALT_FPGA_POLL_t * poll, ALT_STATUS_CODE status)
+{
+    if (alt_fpga_trace != NULL)
+    {
+        ALT_FPGA_WAIT_STATS_t * stats = &alt_fpga_trace->wait[poll->wait];
+        uint64_t elapsed = alt_fpga_trace_now() - poll->start;
+
+        stats->calls++;
+        if (status == ALT_E_TMO)
+        {
+            stats->timeouts++;
+        }
+        stats->iterations += poll->iterations + 1;
+        stats->yields     += poll->yields;
+        stats->sleeps     += poll->sleeps;
+        stats->elapsed_ns += elapsed;
+        if (elapsed > stats->max_ns)
+        {
+            stats->max_ns = elapsed;
+        }
+    }
+}
+
+#define ALT_FPGA_TRACE_STEP(step) \
+    do { if (alt_fpga_trace != NULL) { alt_fpga_trace->step_ns[(step)] = alt_fpga_trace_now(); } } while (0)
+
+/*
+ * User defined writer of the configuration data (NULL: word by word writes).
+*/
+static alt_fpga_axi_writer_t alt_fpga_axi_writer      = NULL;
+static void *                alt_fpga_axi_writer_data = NULL;
+
 #if ALT_FPGA_ENABLE_DMA_SUPPORT
 static ALT_STATUS_CODE alt_dma_channel_wait_for_state(ALT_DMA_CHANNEL_t channel,
                                                       ALT_DMA_CHANNEL_STATE_t state,
@@ -147,6 +304,71 @@ static ALT_STATUS_CODE alt_dma_channel_wait_for_state(ALT_DMA_CHANNEL_t channel,
 }
 #endif
 
+/* Number of bytes of one PIO block to the FPGA Manager data aperture. */
+#define ALT_FPGA_PIO_BURST_SIZE 32
+
+/*
+ * Experimental store variants, selected with the CMake option
+ * RSTOOLS_PIO_BURST=STM|NEON: ALT_FPGA_PIO_USE_STM=1 uses LDM/STM and
+ * ALT_FPGA_PIO_USE_NEON=1 uses NEON 64-bit stores. Neither variant was
+ * compiled or measured on the target yet, so both are off by default.
+ */
+#ifndef ALT_FPGA_PIO_USE_STM
+#define ALT_FPGA_PIO_USE_STM    (0)
+#endif
+#ifndef ALT_FPGA_PIO_USE_NEON
+#define ALT_FPGA_PIO_USE_NEON   (0)
+#endif
+
+/*
+ * Helper function which writes blocks of ALT_FPGA_PIO_BURST_SIZE bytes to
+ * the FPGA Manager data aperture. Every address of the aperture writes to
+ * the data register, so the words of a block are stored to consecutive
+ * addresses. The default is an unrolled loop of single 32-bit stores, it
+ * only saves loop overhead compared to alt_write_word. Whether the
+ * experimental variants reach the bus as bursts is not verified.
+ * The source buffer must be 32-bit aligned.
+*/
+static void alt_fpga_internal_pio_burst(const uint32_t * src, volatile void * dst, uint32_t loops32)
+{
+#if defined(__arm__) && defined(__ARM_NEON__) && ALT_FPGA_PIO_USE_NEON
+    __asm__ volatile(
+        "1:  vld1.32 {d0-d3}, [%0]!     \n"
+        "    vst1.64 {d0-d3}, [%2]      \n"
+        "    subs    %1, %1, #1         \n"
+        "    bne     1b                 \n"
+        : "+r"(src), "+r"(loops32)
+        : "r"(dst)
+        : "d0", "d1", "d2", "d3", "cc", "memory");
+#elif defined(__arm__) && ALT_FPGA_PIO_USE_STM
+    __asm__ volatile(
+        "1:  ldmia   %0!, {r0-r3}       \n"
+        "    stmia   %2,  {r0-r3}       \n"
+        "    ldmia   %0!, {r0-r3}       \n"
+        "    stmia   %3,  {r0-r3}       \n"
+        "    subs    %1, %1, #1         \n"
+        "    bne     1b                 \n"
+        : "+r"(src), "+r"(loops32)
+        : "r"(dst), "r"((volatile char *) dst + 16)
+        : "r0", "r1", "r2", "r3", "cc", "memory");
+#else
+    /* Default: unrolled stores to consecutive addresses. */
+    volatile uint32_t * dst_32 = (volatile uint32_t *) dst;
+    while (loops32--)
+    {
+        dst_32[0] = src[0];
+        dst_32[1] = src[1];
+        dst_32[2] = src[2];
+        dst_32[3] = src[3];
+        dst_32[4] = src[4];
+        dst_32[5] = src[5];
+        dst_32[6] = src[6];
+        dst_32[7] = src[7];
+        src += 8;
+    }
+#endif
+}
+
 /*
  * Helper function which handles writing data to the AXI bus.
 */
@@ -191,17 +413,32 @@ static ALT_STATUS_CODE alt_fpga_internal_writeaxi(const void * bufferv, uint32_t
     }
     else
 #endif
+    if (alt_fpga_axi_writer != NULL)
+    {
+        /* Leave cfg_buf_len untouched, the unaligned rest is written below. */
+        dprintf("FPGA[AXI]: user defined writer ...\n");
+        status = alt_fpga_axi_writer(cfg_buf, cfg_buf_len & ~0x3, alt_fpga_axi_writer_data);
+    }
+    else
     {
-		uint32_t i = 0;
         const uint32_t * buffer_32 = (const uint32_t *) cfg_buf;
+        uint32_t words = cfg_buf_len / sizeof(uint32_t);
+        uint32_t i = 0;
 
-        dprintf("FPGA[AXI]: PIO memcpy() ...\n");
+        dprintf("FPGA[AXI]: PIO blocks ...\n");
 
-        /* Write out as many complete 32-bit chunks. */
-        while (cfg_buf_len >= sizeof(uint32_t))
+        /* Write out as many complete blocks as possible. cfg_buf_len is left
+         * untouched, the unaligned rest is written below. */
+        if ((((uintptr_t) cfg_buf & 0x3) == 0) && (cfg_buf_len >= ALT_FPGA_PIO_BURST_SIZE))
         {
-            alt_write_word(ALT_FPGAMGRDATA_ADDR, buffer_32[i++]);
-            cfg_buf_len -= sizeof(uint32_t);
+            alt_fpga_internal_pio_burst(buffer_32, ALT_FPGAMGRDATA_ADDR, cfg_buf_len / ALT_FPGA_PIO_BURST_SIZE);
+            i = (cfg_buf_len / ALT_FPGA_PIO_BURST_SIZE) * (ALT_FPGA_PIO_BURST_SIZE / sizeof(uint32_t));
+        }
+
+        /* Write out the remaining complete 32-bit chunks. */
+        for (; i < words; i++)
+        {
+            alt_write_word(ALT_FPGAMGRDATA_ADDR, buffer_32[i]);
         }
     }
 
@@ -237,11 +474,12 @@ static ALT_STATUS_CODE alt_fpga_internal_writeaxi(const void * bufferv, uint32_t
  * count completed, and clear the complete status.
  * Returns:
  *  - ALT_E_SUCCESS if the FPGA DCLKSTAT reports that the DCLK count is done.
- *  - ALT_E_TMO     if the number of polling cycles exceeds the timeout value.
+ *  - ALT_E_TMO     if the deadline of timeout_us has passed.
  * */
-static ALT_STATUS_CODE dclk_set_and_wait_clear(uint32_t count, uint32_t timeout)
+static ALT_STATUS_CODE dclk_set_and_wait_clear(uint32_t count, uint32_t timeout_us)
 {
     ALT_STATUS_CODE status = ALT_E_TMO;
+    ALT_FPGA_POLL_t poll;
 
     /* Clear any existing DONE status. This can happen if a previous call to
      * this function returned timeout. The counter would complete later on but
@@ -255,6 +493,7 @@ static ALT_STATUS_CODE dclk_set_and_wait_clear(uint32_t count, uint32_t timeout)
     alt_write_word(ALT_FPGAMGR_DCLKCNT_ADDR, count);
 
     /* Poll DCLKSTAT to see if it completed in the timeout period specified. */
+    alt_fpga_poll_begin(&poll, ALT_FPGA_WAIT_DCLK, timeout_us);
     do
     {
         uint32_t done = alt_read_word(ALT_FPGAMGR_DCLKSTAT_ADDR);
@@ -270,9 +509,10 @@ static ALT_STATUS_CODE dclk_set_and_wait_clear(uint32_t count, uint32_t timeout)
             break;
         }
     }
-    while (timeout--);
+    while (alt_fpga_poll_next(&poll));
 
     dprintf("\n");
+    alt_fpga_poll_end(&poll, status);
 
     return status;
 }
@@ -281,14 +521,16 @@ static ALT_STATUS_CODE dclk_set_and_wait_clear(uint32_t count, uint32_t timeout)
  * Helper function which waits for the FPGA to enter the specified state.
  * Returns:
  *  - ALT_E_SUCCESS if successful
- *  - ALT_E_TMO     if the number of polling cycles exceeds the timeout value.
+ *  - ALT_E_TMO     if the deadline of timeout_us has passed.
  * */
-static ALT_STATUS_CODE wait_for_fpga_state(ALT_FPGA_STATE_t state, uint32_t timeout)
+static ALT_STATUS_CODE wait_for_fpga_state(ALT_FPGA_STATE_t state, uint32_t timeout_us)
 {
     ALT_STATUS_CODE status = ALT_E_TMO;
+    ALT_FPGA_POLL_t poll;
 
     /* Poll on the state to see if it matches the requested state within the
      * timeout period specified. */
+    alt_fpga_poll_begin(&poll, ALT_FPGA_WAIT_STATE, timeout_us);
     do
     {
         ALT_FPGA_STATE_t current = alt_fpga_state_get();
@@ -301,9 +543,10 @@ static ALT_STATUS_CODE wait_for_fpga_state(ALT_FPGA_STATE_t state, uint32_t time
             break;
         }
     }
-    while (timeout--);
+    while (alt_fpga_poll_next(&poll));
 
     dprintf("\n");
+    alt_fpga_poll_end(&poll, status);
 
     return status;
 }
@@ -316,15 +559,17 @@ static ALT_STATUS_CODE wait_for_fpga_state(ALT_FPGA_STATE_t state, uint32_t time
  *  - ALT_E_SUCCESS  if CB monitor reports configuration successful.
  *  - ALT_E_FPGA_CFG if CB monitor reports configuration failure.
  *  - ALT_E_FPGA_CRC if CB monitor reports a CRC error.
- *  - ALT_E_TMO      if CONF_DONE and nSTATUS fails to "settle" in the number
- *                   of polling cycles specified by the timeout value.
+ *  - ALT_E_TMO      if CONF_DONE and nSTATUS fails to "settle" before the
+ *                   deadline of timeout_us.
  * */
-static ALT_STATUS_CODE wait_for_config_done(uint32_t timeout)
+static ALT_STATUS_CODE wait_for_config_done(uint32_t timeout_us)
 {
     ALT_STATUS_CODE retval = ALT_E_TMO;
+    ALT_FPGA_POLL_t poll;
 
     /* Poll on the CONF_DONE and nSTATUS both being set within the timeout
      * period specified. */
+    alt_fpga_poll_begin(&poll, ALT_FPGA_WAIT_CONFIG, timeout_us);
     do
     {
         uint32_t status = alt_fpga_mon_status_get();
@@ -353,9 +598,10 @@ static ALT_STATUS_CODE wait_for_config_done(uint32_t timeout)
             break;
         }
     }
-    while (timeout--);
+    while (alt_fpga_poll_next(&poll));
 
     dprintf("\n");
+    alt_fpga_poll_end(&poll, retval);
 
     return retval;
 }
@@ -517,6 +763,8 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
      * is larger than the Cyclone 5 SoC, this value will also be sufficient for
      * the Cyclone 5 SoC device. */
 
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_DATA_START);
+
     if (fpga_data->type == FPGA_DATA_FULL)
     {
         if (fpga_data->mode.full.length > data_limit)
@@ -531,18 +779,39 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
                                                 fpga_data->use_dma, fpga_data->dma_channel
 #endif
             );
+
+            if (alt_fpga_trace != NULL)
+            {
+                alt_fpga_trace->bytes  = fpga_data->mode.full.length;
+                alt_fpga_trace->chunks = 1;
+            }
         }
     }
     else
     {
-        uint32_t buffer[ISTREAM_CHUNK_SIZE / sizeof(uint32_t)];
+        static uint32_t buffer[ISTREAM_CHUNK_SIZE / sizeof(uint32_t)];
         int32_t cb_status = 0; /* Callback status */
+        const void * chunk = buffer;
+
+        uint64_t t0 = 0, t1 = 0, t2 = 0;
 
         do
         {
-            cb_status = fpga_data->mode.istream.stream(buffer, sizeof(buffer), fpga_data->mode.istream.data);
+            if (alt_fpga_trace != NULL) { t0 = alt_fpga_trace_now(); }
 
-            if (cb_status > sizeof(buffer))
+            if (fpga_data->type == FPGA_DATA_ISTREAM_MAP)
+            {
+                /* The source hands over its own buffer, nothing is copied. */
+                cb_status = fpga_data->mode.istream_map.stream(&chunk, fpga_data->mode.istream_map.data);
+            }
+            else
+            {
+                cb_status = fpga_data->mode.istream.stream(buffer, sizeof(buffer), fpga_data->mode.istream.data);
+            }
+
+            if (alt_fpga_trace != NULL) { t1 = alt_fpga_trace_now(); }
+
+            if ((fpga_data->type == FPGA_DATA_ISTREAM) && (cb_status > sizeof(buffer)))
             {
                 /* Callback data overflows buffer space. */
                 status = ALT_E_FPGA_CFG_STM;
@@ -565,7 +834,7 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
             else
             {
                 /* Copy in configuration data. */
-                status = alt_fpga_internal_writeaxi(buffer, cb_status
+                status = alt_fpga_internal_writeaxi(chunk, cb_status
 #if ALT_FPGA_ENABLE_DMA_SUPPORT
                                                     ,
                                                     fpga_data->use_dma, fpga_data->dma_channel
@@ -573,6 +842,15 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
                     );
 
                 data_limit -= cb_status;
+
+                if (alt_fpga_trace != NULL)
+                {
+                    t2 = alt_fpga_trace_now();
+                    alt_fpga_trace->stream_ns += t1 - t0;
+                    alt_fpga_trace->write_ns  += t2 - t1;
+                    alt_fpga_trace->bytes     += cb_status;
+                    alt_fpga_trace->chunks++;
+                }
             }
 
             if (status != ALT_E_SUCCESS)
@@ -583,6 +861,15 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
         } while (cb_status > 0);
     }
 
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_DATA_DONE);
+
+    /* For a full buffer the whole step is spent writing. */
+    if ((alt_fpga_trace != NULL) && (fpga_data->type == FPGA_DATA_FULL))
+    {
+        alt_fpga_trace->write_ns = alt_fpga_trace->step_ns[ALT_FPGA_TRACE_DATA_DONE]
+                                 - alt_fpga_trace->step_ns[ALT_FPGA_TRACE_DATA_START];
+    }
+
     if (status != ALT_E_SUCCESS)
     {
         dprintf("FPGA: Error in step 9: Problem streaming or writing out AXI data.\n");
@@ -596,7 +883,7 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
 
     dprintf("FPGA: === Step 10 ===\n");
 
-    status = wait_for_config_done(_ALT_FPGA_TMO_CONFIG);
+    status = wait_for_config_done(_ALT_FPGA_TMO_CONFIG_US);
 
     if (status != ALT_E_SUCCESS)
     {
@@ -617,6 +904,8 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
         }
     }
 
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_CONF_DONE);
+
     return ALT_E_SUCCESS;
 }
 
@@ -624,7 +913,7 @@ static ALT_STATUS_CODE alt_fpga_internal_configure_idata(FPGA_DATA_t * fpga_data
  * Helper function which does handles the common steps for Full Buffer or
  * IStream FPGA configuration.
  * */
-static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
+static ALT_STATUS_CODE alt_fpga_internal_configure_steps(FPGA_DATA_t * fpga_data)
 {
     ALT_STATUS_CODE status = ALT_E_SUCCESS;
     uint32_t ctrl_reg;
@@ -773,7 +1062,7 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
 
     dprintf("FPGA: === Step 4 ===\n");
 
-    status = wait_for_fpga_state(ALT_FPGA_STATE_RESET, _ALT_FPGA_TMO_STATE);
+    status = wait_for_fpga_state(ALT_FPGA_STATE_RESET, _ALT_FPGA_TMO_STATE_US);
     /* Handle any error conditions after reset has been unasserted. */
 
     /* Step 5:
@@ -791,12 +1080,14 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
         return ALT_E_FPGA_CFG;
     }
 
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_RESET);
+
     /* Step 6:
      *  - Wait for STATUS.MODE to report FPGA is in configuration phase */
 
     dprintf("FPGA: === Step 6 ===\n");
 
-    status = wait_for_fpga_state(ALT_FPGA_STATE_CFG, _ALT_FPGA_TMO_STATE);
+    status = wait_for_fpga_state(ALT_FPGA_STATE_CFG, _ALT_FPGA_TMO_STATE_US);
 
     if (status != ALT_E_SUCCESS)
     {
@@ -804,6 +1095,8 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
         return ALT_E_FPGA_CFG;
     }
 
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_CFG);
+
     /* Step 7:
      *  - Clear nSTATUS interrupt in CB Monitor */
 
@@ -841,7 +1134,7 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
 
     dprintf("FPGA: === Step 12 ===\n");
 
-    status = dclk_set_and_wait_clear(4, _ALT_FPGA_TMO_DCLK_CONST + 4 * _ALT_FPGA_TMO_DCLK_MUL);
+    status = dclk_set_and_wait_clear(4, _ALT_FPGA_TMO_DCLK_CONST_US + 4 * _ALT_FPGA_TMO_DCLK_MUL_US);
     if (status != ALT_E_SUCCESS)
     {
         dprintf("FPGA: Error in step 12: Wait for dclk(4) timeout.\n");
@@ -857,6 +1150,8 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
         }
     }
 
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_DCLK);
+
 #if _ALT_FPGA_USE_DCLK
 
     /* Extra steps for Configuration with DCLK for Initialization Phase (4.2.1.2) */
@@ -868,7 +1163,7 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
     dprintf("FPGA: === Step 14 (4.2.1.2) ===\n");
     dprintf("FPGA: === Step 15 (4.2.1.2) ===\n");
     
-    status = dclk_set_and_wait_clear(0x5000, _ALT_FPGA_TMO_DCLK_CONST + 0x5000 * _ALT_FPGA_TMO_DCLK_MUL);
+    status = dclk_set_and_wait_clear(0x5000, _ALT_FPGA_TMO_DCLK_CONST_US + 0x5000 * _ALT_FPGA_TMO_DCLK_MUL_US);
     if (status == ALT_E_TMO)
     {
         dprintf("FPGA: Error in step 15 (4.2.1.2): Wait for dclk(0x5000) timeout.\n");
@@ -891,7 +1186,7 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
 
     dprintf("FPGA: === Step 13 ===\n");
 
-    status = wait_for_fpga_state(ALT_FPGA_STATE_USER_MODE, _ALT_FPGA_TMO_STATE);
+    status = wait_for_fpga_state(ALT_FPGA_STATE_USER_MODE, _ALT_FPGA_TMO_STATE_US);
     if (status == ALT_E_TMO)
     {
         dprintf("FPGA: Error in step 13: Wait for state = USER_MODE timeout.\n");
@@ -907,6 +1202,8 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
         }
     }
 
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_USER_MODE);
+
     /* Step 14:
      *  - Set CTRL.EN to 0 */
 
@@ -918,6 +1215,31 @@ static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
     return data_status;
 }
 
+/*
+ * Helper function which runs the configuration steps and fills in the
+ * start, the end and the result of the trace.
+ * */
+static ALT_STATUS_CODE alt_fpga_internal_configure(FPGA_DATA_t * fpga_data)
+{
+    ALT_STATUS_CODE status;
+
+    if (alt_fpga_trace != NULL)
+    {
+        memset(alt_fpga_trace, 0, sizeof(ALT_FPGA_TRACE_t));
+    }
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_START);
+
+    status = alt_fpga_internal_configure_steps(fpga_data);
+
+    ALT_FPGA_TRACE_STEP(ALT_FPGA_TRACE_END);
+    if (alt_fpga_trace != NULL)
+    {
+        alt_fpga_trace->status = status;
+    }
+
+    return status;
+}
+
 ALT_STATUS_CODE alt_fpga_configure(const void* cfg_buf, 
                                    size_t cfg_buf_len)
 {
@@ -962,6 +1284,20 @@ ALT_STATUS_CODE alt_fpga_istream_configure(alt_fpga_istream_t cfg_stream,
     return alt_fpga_internal_configure(&fpga_data);
 }
 
+ALT_STATUS_CODE alt_fpga_istream_map_configure(alt_fpga_istream_map_t cfg_stream,
+                                               void * user_data)
+{
+    FPGA_DATA_t fpga_data;
+    fpga_data.type                    = FPGA_DATA_ISTREAM_MAP;
+    fpga_data.mode.istream_map.stream = cfg_stream;
+    fpga_data.mode.istream_map.data   = user_data;
+#if ALT_FPGA_ENABLE_DMA_SUPPORT
+    fpga_data.use_dma                 = false;
+#endif
+
+    return alt_fpga_internal_configure(&fpga_data);
+}
+
 #if ALT_FPGA_ENABLE_DMA_SUPPORT
 ALT_STATUS_CODE alt_fpga_istream_configure_dma(alt_fpga_istream_t cfg_stream,
                                                void * user_data,
@@ -978,6 +1314,22 @@ ALT_STATUS_CODE alt_fpga_istream_configure_dma(alt_fpga_istream_t cfg_stream,
 }
 #endif
 
+ALT_STATUS_CODE alt_fpga_trace_set(ALT_FPGA_TRACE_t * trace)
+{
+    alt_fpga_trace = trace;
+
+    return ALT_E_SUCCESS;
+}
+
+ALT_STATUS_CODE alt_fpga_axi_writer_set(alt_fpga_axi_writer_t writer,
+                                        void * user_data)
+{
+    alt_fpga_axi_writer      = writer;
+    alt_fpga_axi_writer_data = user_data;
+
+    return ALT_E_SUCCESS;
+}
+
 uint32_t alt_fpga_gpi_read(uint32_t mask)
 {
     if (mask == 0)
@@ -522,6 +522,33 @@ ALT_STATUS_CODE alt_fpga_cfg_mode_set(ALT_FPGA_CFG_MODE_t cfg_mode);
  */
 typedef int32_t (*alt_fpga_istream_t)(void* buf, size_t buf_len, void* user_data);
 
+/*!
+ * Type definition for a user defined zero-copy input stream of FPGA
+ * configuration data.
+ *
+ * Unlike alt_fpga_istream_t the callback does not copy the data into a buffer
+ * of the FPGA Manager, it returns a pointer to the next chunk in its own
+ * memory. The chunk must stay valid until the callback is invoked again or
+ * the configuration ends. This allows a producer (e.g. a reader thread) to
+ * fill large buffers that the FPGA Manager writes directly to the AXI data
+ * register. All chunks except the last one must be a multiple of 4 bytes
+ * and 32-bit aligned.
+ *
+ * \param       buf
+ *              Returns a pointer to the next chunk of configuration bitstream
+ *              data bytes.
+ *
+ * \param       user_data
+ *              A 32-bit data word for passing user defined data. The FPGA
+ *              Manager merely forwards the \e user_data value when it invokes
+ *              the callback.
+ *
+ * \retval      >0      The number of bytes of the chunk at \e buf.
+ * \retval      =0      The end of the input stream has been reached.
+ * \retval      <0      An error occurred on the input stream.
+ */
+typedef int32_t (*alt_fpga_istream_map_t)(const void** buf, void* user_data);
+
 /*!
  * \addtogroup FPGA_MGR_CFG_FULL FPGA Full Configuration
  *
@@ -643,6 +670,33 @@ ALT_STATUS_CODE alt_fpga_configure_dma(const void* cfg_buf,
 ALT_STATUS_CODE alt_fpga_istream_configure(alt_fpga_istream_t cfg_stream,
                                            void * user_data);
 
+/*!
+ * Perform a full configuration of the FPGA from a user defined zero-copy
+ * input stream (see alt_fpga_istream_map_t). The error handling is the same
+ * as for alt_fpga_istream_configure().
+ *
+ * \param       cfg_stream
+ *              A pointer to a callback function that returns the consecutive
+ *              chunks of the configuration bitstream data.
+ *
+ * \param       user_data
+ *              A 32-bit user defined data word. The FPGA Manager merely
+ *              forwards the \e user_data value when it invokes the \e
+ *              cfg_stream callback.
+ *
+ * \retval      ALT_E_SUCCESS           FPGA configuration FPGA was successful.
+ * \retval      ALT_E_FPGA_CFG          FPGA configuration error detected.
+ * \retval      ALT_E_FPGA_CRC          FPGA CRC error detected.
+ * \retval      ALT_E_FPGA_CFG_STM      An error occurred on the FPGA
+ *                                      configuration bitstream input source.
+ * \retval      ALT_E_FPGA_PWR_OFF      FPGA is not powered on.
+ * \retval      ALT_E_FPGA_NO_SOC_CTRL  SoC software is not in control of the
+ *                                      FPGA. Use alt_fpga_control_enable() to
+ *                                      gain control.
+ */
+ALT_STATUS_CODE alt_fpga_istream_map_configure(alt_fpga_istream_map_t cfg_stream,
+                                               void * user_data);
+
 #if ALT_FPGA_ENABLE_DMA_SUPPORT
 
 /*!
@@ -688,6 +742,115 @@ ALT_STATUS_CODE alt_fpga_istream_configure_dma(alt_fpga_istream_t cfg_stream,
 
 #endif
 
+/*!
+ * Steps of the FPGA configuration that are timestamped by the trace.
+ */
+typedef enum ALT_FPGA_TRACE_STEP_e
+{
+    ALT_FPGA_TRACE_START      = 0,  /*!< Configuration started. */
+    ALT_FPGA_TRACE_RESET      = 1,  /*!< Step 4: FPGA entered the reset phase. */
+    ALT_FPGA_TRACE_CFG        = 2,  /*!< Step 6: FPGA entered the configuration phase. */
+    ALT_FPGA_TRACE_DATA_START = 3,  /*!< Step 9: First configuration data requested. */
+    ALT_FPGA_TRACE_DATA_DONE  = 4,  /*!< Step 9: All configuration data written. */
+    ALT_FPGA_TRACE_CONF_DONE  = 5,  /*!< Step 10: CONF_DONE and nSTATUS reported. */
+    ALT_FPGA_TRACE_DCLK       = 6,  /*!< Step 12: DCLK count completed. */
+    ALT_FPGA_TRACE_USER_MODE  = 7,  /*!< Step 13: FPGA entered user mode. */
+    ALT_FPGA_TRACE_END        = 8,  /*!< Configuration finished (or aborted). */
+    ALT_FPGA_TRACE_STEPS      = 9
+} ALT_FPGA_TRACE_STEP_t;
+
+/*!
+ * Polling loops of the FPGA configuration with statistics in the trace.
+ */
+typedef enum ALT_FPGA_WAIT_e
+{
+    ALT_FPGA_WAIT_STATE  = 0,   /*!< Wait for a state of the FPGA (steps 4, 6, 13). */
+    ALT_FPGA_WAIT_CONFIG = 1,   /*!< Wait for CONF_DONE and nSTATUS (step 10). */
+    ALT_FPGA_WAIT_DCLK   = 2,   /*!< Wait for the DCLK count (step 12). */
+    ALT_FPGA_WAITS       = 3
+} ALT_FPGA_WAIT_t;
+
+/*!
+ * Statistics of the polling loops of one kind.
+ */
+typedef struct ALT_FPGA_WAIT_STATS_s
+{
+    uint32_t calls;         /*!< Number of waits. */
+    uint32_t timeouts;      /*!< Number of waits that passed the deadline. */
+    uint64_t iterations;    /*!< Register polls of all waits. */
+    uint64_t yields;        /*!< Polls followed by sched_yield(). */
+    uint64_t sleeps;        /*!< Polls followed by a sleep. */
+    uint64_t elapsed_ns;    /*!< Total time of all waits. */
+    uint64_t max_ns;        /*!< Longest wait. */
+} ALT_FPGA_WAIT_STATS_t;
+
+/*!
+ * Timing record of one FPGA configuration. All times are monotonic clock
+ * values in ns. A step that was not reached keeps the time 0.
+ */
+typedef struct ALT_FPGA_TRACE_s
+{
+    uint64_t step_ns[ALT_FPGA_TRACE_STEPS]; /*!< Timestamp of each step. */
+    uint64_t stream_ns;     /*!< Time spent in the IStream callback (source I/O). */
+    uint64_t write_ns;      /*!< Time spent writing to the AXI data register. */
+    uint64_t bytes;         /*!< Configuration data bytes written. */
+    uint32_t chunks;        /*!< Number of IStream chunks (1 for a full buffer). */
+    int32_t  status;        /*!< Returned ALT_STATUS_CODE. */
+    ALT_FPGA_WAIT_STATS_t wait[ALT_FPGA_WAITS]; /*!< Statistics of the polling loops. */
+} ALT_FPGA_TRACE_t;
+
+/*!
+ * Install or remove a timing record. While a record is installed, every
+ * configuration clears it and fills in the timestamps of its steps. Without
+ * a record the configuration is not slowed down by reading the clock.
+ *
+ * \param       trace
+ *              The record to fill or NULL to disable the trace.
+ *
+ * \retval      ALT_E_SUCCESS   The operation was successful.
+ */
+ALT_STATUS_CODE alt_fpga_trace_set(ALT_FPGA_TRACE_t * trace);
+
+/*!
+ * Type definition for a user defined writer of FPGA configuration data.
+ *
+ * When a writer is installed with alt_fpga_axi_writer_set(), the FPGA Manager
+ * passes every 32-bit aligned part of the configuration bitstream to the
+ * writer instead of writing it word by word to the AXI data register. This
+ * allows an operating system to move the data with its own DMA engine. The
+ * remaining 1 to 3 byte(s) of an unaligned image are still written by the
+ * FPGA Manager.
+ *
+ * \param       buf
+ *              A pointer to the configuration bitstream data (the same
+ *              pointer that was passed to alt_fpga_configure() or the
+ *              internal IStream chunk buffer).
+ *
+ * \param       buf_len
+ *              The number of bytes to write, a multiple of 4.
+ *
+ * \param       user_data
+ *              The user defined data word passed to alt_fpga_axi_writer_set().
+ *
+ * \retval      ALT_E_SUCCESS   All data was written to the AXI data register.
+ * \retval      <0              An error occurred, the configuration is aborted.
+ */
+typedef ALT_STATUS_CODE (*alt_fpga_axi_writer_t)(const void* buf, size_t buf_len, void* user_data);
+
+/*!
+ * Install or remove a user defined writer of FPGA configuration data.
+ *
+ * \param       writer
+ *              The writer to use or NULL to restore the word by word writes.
+ *
+ * \param       user_data
+ *              A user defined data word that is forwarded to the writer.
+ *
+ * \retval      ALT_E_SUCCESS   The operation was successful.
+ */
+ALT_STATUS_CODE alt_fpga_axi_writer_set(alt_fpga_axi_writer_t writer,
+                                        void * user_data);
+
 /*!
  * @}
  */
@@ -0,0 +1,213 @@
+/**
+ *
+ * @file    config_cache.cpp
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Bitstream cache: configuration images resident in a shared memory arena
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "config_cache.h"
+#include "config_source.h"			// raw or compressed configuration file
+#include "rstools_time.h"			// rstools timestamps
+
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <cerrno>
+#include <fcntl.h>					// POSIX: O_CREAT, O_RDWR
+#include <unistd.h>					// POSIX: ftruncate, close
+#include <sys/mman.h>				// POSIX: shm_open, mmap, madvise
+#include <sys/stat.h>				// POSIX: fstat, stat
+#include <sys/file.h>				// POSIX: flock
+
+using namespace std;
+
+/*
+*   @brief               Reset the header of a new or incompatible arena
+*/
+static void initHeader(configCacheHeader_t* header)
+{
+	memset(header, 0, sizeof(configCacheHeader_t));
+	header->version = CONFIG_CACHE_VERSION;
+	header->slots = CONFIG_CACHE_SLOTS;
+	header->slotSize = CONFIG_CACHE_SLOT_SIZE;
+	// The magic is written last, it marks a valid header
+	memcpy(header->magic, CONFIG_CACHE_MAGIC, 4);
+}
+
+bool configCacheOpen(configCache_t* cache, bool create)
+{
+	cache->arena = nullptr;
+	cache->header = nullptr;
+	cache->fd = shm_open(CONFIG_CACHE_SHM, create ? (O_RDWR | O_CREAT) : O_RDWR, 0600);
+	if (cache->fd < 0) return false;
+
+	if (flock(cache->fd, LOCK_EX) != 0)
+	{
+		close(cache->fd);
+		cache->fd = -1;
+		return false;
+	}
+
+	// A new arena is sparse: only the used pages take memory
+	struct stat st;
+	if ((fstat(cache->fd, &st) != 0) || \
+		(((size_t) st.st_size != CONFIG_CACHE_ARENA_SIZE) && (ftruncate(cache->fd, CONFIG_CACHE_ARENA_SIZE) != 0)))
+	{
+		configCacheClose(cache);
+		return false;
+	}
+
+	void* map = mmap(NULL, CONFIG_CACHE_ARENA_SIZE, (PROT_READ | PROT_WRITE), MAP_SHARED, cache->fd, 0);
+	if (map == MAP_FAILED)
+	{
+		configCacheClose(cache);
+		return false;
+	}
+	cache->arena = (uint8_t*) map;
+	cache->header = (configCacheHeader_t*) map;
+
+	// Transparent huge pages for the images (if the shmem setting allows it)
+#ifdef MADV_HUGEPAGE
+	madvise(cache->arena + CONFIG_CACHE_DATA_OFST, CONFIG_CACHE_ARENA_SIZE - CONFIG_CACHE_DATA_OFST, MADV_HUGEPAGE);
+#endif
+
+	configCacheHeader_t* header = cache->header;
+	if ((memcmp(header->magic, CONFIG_CACHE_MAGIC, 4) != 0) || (header->version != CONFIG_CACHE_VERSION) || \
+		(header->slots != CONFIG_CACHE_SLOTS) || (header->slotSize != CONFIG_CACHE_SLOT_SIZE))
+		initHeader(header);
+
+	return true;
+}
+
+void configCacheClose(configCache_t* cache)
+{
+	if (cache->arena != nullptr)
+		munmap(cache->arena, CONFIG_CACHE_ARENA_SIZE);
+	if (cache->fd >= 0)
+	{
+		flock(cache->fd, LOCK_UN);
+		close(cache->fd);
+	}
+	cache->arena = nullptr;
+	cache->header = nullptr;
+	cache->fd = -1;
+}
+
+bool configCacheFlush(void)
+{
+	return (shm_unlink(CONFIG_CACHE_SHM) == 0) || (errno == ENOENT);
+}
+
+const uint8_t* configCacheData(const configCache_t* cache, uint8_t slot)
+{
+	return cache->arena + CONFIG_CACHE_DATA_OFST + (size_t) slot * CONFIG_CACHE_SLOT_SIZE;
+}
+
+/*
+*   @brief               Read the whole configuration data into a slot
+*   @return              result of the load (MISS on success)
+*/
+static configCacheResult_t loadSlot(configCache_t* cache, uint8_t idx, const char* fileName)
+{
+	configCacheSlot_t* slot = &cache->header->slot[idx];
+	uint8_t* data = (uint8_t*) configCacheData(cache, idx);
+
+	configSource_t src;
+	if (!configSourceOpen(&src, fileName))
+		return CONFIG_CACHE_ERROR;
+
+	uint64_t start = rsTimeNowNs();
+	ssize_t len = configSourceRead(&src, data, CONFIG_CACHE_SLOT_SIZE);
+	uint8_t probe;
+	configCacheResult_t res = CONFIG_CACHE_MISS;
+	if (len <= 0)
+		res = CONFIG_CACHE_ERROR;
+	else if ((len == CONFIG_CACHE_SLOT_SIZE) && (configSourceRead(&src, &probe, 1) != 0))
+		res = CONFIG_CACHE_TOO_LARGE;
+	uint64_t hash = configSourceHash(&src);
+	configSourceClose(&src);
+
+	if (res != CONFIG_CACHE_MISS)
+	{
+		// Give the memory of the slot back
+		madvise(data, CONFIG_CACHE_SLOT_SIZE, MADV_REMOVE);
+		return res;
+	}
+
+	slot->size = len;
+	slot->hash = hash;
+	slot->loadNs = rsTimeNowNs() - start;
+	slot->hits = 0;
+	// Free the pages of a larger image that was stored before
+	size_t used = (len + 4095) & ~((size_t) 4095);
+	if (used < CONFIG_CACHE_SLOT_SIZE)
+		madvise(data + used, CONFIG_CACHE_SLOT_SIZE - used, MADV_REMOVE);
+	return res;
+}
+
+configCacheResult_t configCacheGet(configCache_t* cache, const char* fileName, uint8_t* slotIdx)
+{
+	configCacheHeader_t* header = cache->header;
+
+	char path[PATH_MAX];
+	struct stat st;
+	if ((realpath(fileName, path) == nullptr) || (stat(path, &st) != 0))
+		return CONFIG_CACHE_ERROR;
+	if (strlen(path) >= CONFIG_CACHE_NAME_LEN)
+		return CONFIG_CACHE_TOO_LARGE;
+	int64_t mtime = (int64_t) st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+
+	// Look for a valid slot of the unchanged file
+	uint8_t victim = 0;
+	uint64_t victimRank = UINT64_MAX;
+	for (uint8_t i = 0; i < CONFIG_CACHE_SLOTS; i++)
+	{
+		configCacheSlot_t* slot = &header->slot[i];
+		bool sameName = (strcmp(slot->name, path) == 0);
+		if (slot->valid && sameName && (slot->fileSize == (uint64_t) st.st_size) && \
+			(slot->fileMtime == mtime) && (slot->fileIno == (uint64_t) st.st_ino))
+		{
+			slot->hits++;
+			slot->lastUse = ++header->useCounter;
+			header->hits++;
+			*slotIdx = i;
+			return CONFIG_CACHE_HIT;
+		}
+
+		// Replace an old image of the same file, an empty slot or the least recently used one
+		uint64_t rank = sameName ? 0 : (!slot->valid ? 1 : slot->lastUse + 2);
+		if (rank < victimRank)
+		{
+			victim = i;
+			victimRank = rank;
+		}
+	}
+
+	configCacheSlot_t* slot = &header->slot[victim];
+	slot->valid = 0;
+	header->misses++;
+	configCacheResult_t res = loadSlot(cache, victim, path);
+	if (res != CONFIG_CACHE_MISS)
+		return res;
+
+	strcpy(slot->name, path);
+	slot->fileSize = st.st_size;
+	slot->fileMtime = mtime;
+	slot->fileIno = st.st_ino;
+	slot->lastUse = ++header->useCounter;
+	header->loadNs += slot->loadNs;
+	slot->valid = 1;
+
+	*slotIdx = victim;
+	return CONFIG_CACHE_MISS;
+}
@@ -0,0 +1,140 @@
+/**
+ *
+ * @file    config_cache.h
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Bitstream cache: configuration images resident in a shared memory arena
+ *
+ * The arena is a POSIX shared memory object (/dev/shm/rstools-bitcache) with
+ * CONFIG_CACHE_SLOTS slots. Each slot holds the complete (decompressed) image
+ * of one configuration file, named by its canonical path. The arena lives in
+ * RAM (tmpfs) after the process ends, so the next FPGA-writeConfig call with
+ * a cached file only pushes the data to the FPGA Manager, without any file
+ * I/O or decompression. The file is checked with stat() (size, mtime, inode),
+ * a changed file is loaded again.
+ *
+ * An image is only stored after it was read completely (a truncated gzip file
+ * is never cached). The least recently used slot is replaced. Only the used
+ * pages of the arena occupy memory. The arena is locked with flock(), so
+ * concurrent FPGA-writeConfig calls do not corrupt it.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef CONFIG_CACHE_H
+#define CONFIG_CACHE_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+// Shared memory object of the arena
+#define CONFIG_CACHE_SHM			"/rstools-bitcache"
+#define CONFIG_CACHE_MAGIC			"RSBC"
+#define CONFIG_CACHE_VERSION		1
+
+// Number of slots and maximal image size of a slot
+#define CONFIG_CACHE_SLOTS			4
+#define CONFIG_CACHE_SLOT_SIZE		(16*1024*1024)
+#define CONFIG_CACHE_NAME_LEN		256
+
+// Start of the slot data in the arena (page aligned)
+#define CONFIG_CACHE_DATA_OFST		(64*1024)
+#define CONFIG_CACHE_ARENA_SIZE		(CONFIG_CACHE_DATA_OFST + (size_t) CONFIG_CACHE_SLOTS*CONFIG_CACHE_SLOT_SIZE)
+
+/*
+* One cached configuration image
+*/
+typedef struct
+{
+	char name[CONFIG_CACHE_NAME_LEN];		// canonical path of the file
+	uint64_t size;							// bytes of the image
+	uint64_t fileSize;						// size of the file (compressed)
+	int64_t fileMtime;						// modification time of the file in ns
+	uint64_t fileIno;						// inode of the file
+	uint64_t hash;							// content hash of the image (configHash64)
+	uint64_t loadNs;						// time to load the image
+	uint64_t hits;							// configurations served from the slot
+	uint64_t lastUse;						// use counter of the arena (LRU)
+	uint32_t valid;							// 1: the image is complete
+	uint32_t reserved;
+} configCacheSlot_t;
+
+/*
+* Header of the arena
+*/
+typedef struct
+{
+	char magic[4];							// "RSBC"
+	uint32_t version;						// CONFIG_CACHE_VERSION
+	uint32_t slots;							// CONFIG_CACHE_SLOTS
+	uint32_t reserved;
+	uint64_t slotSize;						// CONFIG_CACHE_SLOT_SIZE
+	uint64_t hits;							// lookups served from the cache
+	uint64_t misses;						// lookups that loaded the file
+	uint64_t loadNs;						// total time of all loads
+	uint64_t useCounter;					// counter for the LRU replacement
+	configCacheSlot_t slot[CONFIG_CACHE_SLOTS];
+} configCacheHeader_t;
+
+/*
+* Mapped and locked arena
+*/
+typedef struct
+{
+	int fd;									// shared memory object
+	uint8_t* arena;							// mapped arena
+	configCacheHeader_t* header;			// header at the begin of the arena
+} configCache_t;
+
+/*
+* Result of a lookup
+*/
+typedef enum
+{
+	CONFIG_CACHE_HIT = 0,					// image served from the cache
+	CONFIG_CACHE_MISS = 1,					// image loaded into the cache
+	CONFIG_CACHE_TOO_LARGE = 2,				// image does not fit into a slot
+	CONFIG_CACHE_ERROR = 3					// file could not be read
+} configCacheResult_t;
+
+/*
+*   @brief               Open (or create) the arena, map it and lock it exclusively
+*	@param	cache		 opened arena
+*	@param	create		 create the arena if it does not exist
+*   @return              success
+*/
+bool configCacheOpen(configCache_t* cache, bool create);
+
+/*
+*   @brief               Unlock and unmap the arena (the images stay in the arena)
+*/
+void configCacheClose(configCache_t* cache);
+
+/*
+*   @brief               Remove the arena with all images
+*   @return              success (also if there was no arena)
+*/
+bool configCacheFlush(void);
+
+/*
+*   @brief               Get the image of a configuration file, load it on a miss
+*	@param	cache		 opened arena
+*	@param	fileName	 rbf or rbf.gz file
+*	@param	slot		 slot of the image (for HIT and MISS)
+*   @return              result of the lookup
+*/
+configCacheResult_t configCacheGet(configCache_t* cache, const char* fileName, uint8_t* slot);
+
+/*
+*   @brief               Image data of a slot
+*/
+const uint8_t* configCacheData(const configCache_t* cache, uint8_t slot);
+
+#endif // CONFIG_CACHE_H
@@ -0,0 +1,178 @@
+/**
+ *
+ * @file    config_pipe.cpp
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Double-buffered reader thread for the FPGA configuration data
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "config_pipe.h"
+#include "rstools_time.h"			// rstools timestamps
+
+#include <cstdlib>
+#include <cstring>
+#include <sched.h>					// POSIX: sched_yield
+#include <time.h>					// POSIX: nanosleep
+
+using namespace std;
+
+// Backoff of a waiting side: spin, then yield, then sleep
+#define PIPE_WAIT_SPIN				64
+#define PIPE_WAIT_YIELD				256
+#define PIPE_WAIT_SLEEP_NS			20000
+
+/*
+*   @brief               Wait until a condition is true or the ring is stopped
+*	@param	pipe		 ring
+*	@param	ready		 condition
+*	@param	waitNs		 time of the wait is added
+*   @return              true if the condition is true
+*/
+template <typename cond_t>
+static bool pipeWait(configPipe_t* pipe, cond_t ready, uint64_t* waitNs)
+{
+	if (ready()) return true;
+
+	uint64_t start = rsTimeNowNs();
+	uint32_t rounds = 0;
+	while (!ready())
+	{
+		if (pipe->stop.load(memory_order_relaxed)) return false;
+
+		if (rounds < PIPE_WAIT_SPIN)
+			rounds++;
+		else if (rounds < PIPE_WAIT_YIELD)
+		{
+			sched_yield();
+			rounds++;
+		}
+		else
+		{
+			struct timespec ts = {0, PIPE_WAIT_SLEEP_NS};
+			nanosleep(&ts, nullptr);
+		}
+	}
+	*waitNs += rsTimeNowNs() - start;
+	return true;
+}
+
+/*
+*   @brief               Reader thread: fill the free slots until the end of the source
+*/
+static void pipeReader(configPipe_t* pipe)
+{
+	uint32_t head = pipe->head.load(memory_order_relaxed);
+	while (!pipe->stop.load(memory_order_relaxed))
+	{
+		// Wait for a free slot
+		if (!pipeWait(pipe, [&]() { return (head - pipe->tail.load(memory_order_acquire)) < CONFIG_PIPE_SLOTS; }, \
+			&pipe->readerWaitNs))
+			return;
+
+		uint32_t idx = head % CONFIG_PIPE_SLOTS;
+		ssize_t res = configSourceRead(pipe->src, pipe->slot[idx], pipe->slotSize);
+		pipe->length[idx] = res;
+
+		// Publish the slot (also the end or an error)
+		head++;
+		pipe->head.store(head, memory_order_release);
+		if (res <= 0) return;
+	}
+}
+
+bool configPipeStart(configPipe_t* pipe, configSource_t* src, size_t slotSize)
+{
+	if ((slotSize < CONFIG_PIPE_SLOT_MIN) || (slotSize > CONFIG_PIPE_SLOT_MAX) || (slotSize % 4))
+		return false;
+
+	pipe->src = src;
+	pipe->slotSize = slotSize;
+	pipe->head.store(0);
+	pipe->tail.store(0);
+	pipe->stop.store(false);
+	pipe->consuming = false;
+	pipe->readerWaitNs = 0;
+	pipe->consumerWaitNs = 0;
+
+	bool ok = true;
+	for (uint8_t i = 0; i < CONFIG_PIPE_SLOTS; i++)
+	{
+		pipe->slot[i] = nullptr;
+		pipe->length[i] = 0;
+		if (posix_memalign((void**) &pipe->slot[i], 64, slotSize) != 0)
+		{
+			pipe->slot[i] = nullptr;
+			ok = false;
+		}
+	}
+
+	if (ok)
+	{
+		try
+		{
+			pipe->reader = thread(pipeReader, pipe);
+		}
+		catch (...)
+		{
+			ok = false;
+		}
+	}
+
+	if (!ok)
+	{
+		for (uint8_t i = 0; i < CONFIG_PIPE_SLOTS; i++)
+			free(pipe->slot[i]);
+	}
+	return ok;
+}
+
+int32_t configPipeNext(const void** buf, void* user_data)
+{
+	configPipe_t* pipe = (configPipe_t*) user_data;
+	uint32_t tail = pipe->tail.load(memory_order_relaxed);
+
+	// Release the slot of the previous call
+	if (pipe->consuming)
+	{
+		tail++;
+		pipe->tail.store(tail, memory_order_release);
+		pipe->consuming = false;
+	}
+
+	// Wait for a filled slot
+	if (!pipeWait(pipe, [&]() { return pipe->head.load(memory_order_acquire) != tail; }, &pipe->consumerWaitNs))
+		return -1;
+
+	uint32_t idx = tail % CONFIG_PIPE_SLOTS;
+	ssize_t res = pipe->length[idx];
+
+	// The end or an error stays in the ring, every following call returns it again
+	if (res > 0)
+	{
+		*buf = pipe->slot[idx];
+		pipe->consuming = true;
+	}
+	return (int32_t) res;
+}
+
+void configPipeStop(configPipe_t* pipe)
+{
+	pipe->stop.store(true);
+	if (pipe->reader.joinable())
+		pipe->reader.join();
+
+	for (uint8_t i = 0; i < CONFIG_PIPE_SLOTS; i++)
+	{
+		free(pipe->slot[i]);
+		pipe->slot[i] = nullptr;
+	}
+}
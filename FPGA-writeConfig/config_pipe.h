@@ -0,0 +1,87 @@
+/**
+ *
+ * @file    config_pipe.h
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Double-buffered reader thread for the FPGA configuration data
+ *
+ * A reader thread fills large slots of a single-producer/single-consumer ring
+ * from a configuration source (raw file or decompressed gzip), while the
+ * configuring thread writes the previous slots to the FPGA Manager data
+ * register. File I/O and decompression overlap with the AXI writes, so the
+ * configuration takes about as long as the slower of both, not the sum.
+ *
+ * The ring has no locks: the reader only advances "head", the consumer only
+ * advances "tail". A waiting side spins shortly, then yields and then sleeps.
+ * configPipeNext() is an alt_fpga_istream_map_t callback, the FPGA Manager
+ * writes the slots directly without copying them.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef CONFIG_PIPE_H
+#define CONFIG_PIPE_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include "config_source.h"
+
+// Number of slots of the ring
+#define CONFIG_PIPE_SLOTS			4
+// Slot size (default and allowed range)
+#define CONFIG_PIPE_SLOT_SIZE		(256*1024)
+#define CONFIG_PIPE_SLOT_MIN		(4*1024)
+#define CONFIG_PIPE_SLOT_MAX		(16*1024*1024)
+
+/*
+* Ring of the reader thread
+*/
+typedef struct
+{
+	configSource_t* src;					// source of the reader thread
+	size_t slotSize;						// bytes per slot
+	uint8_t* slot[CONFIG_PIPE_SLOTS];		// slot buffers
+	ssize_t length[CONFIG_PIPE_SLOTS];		// bytes in a slot (0: end, <0: error)
+	std::atomic<uint32_t> head;				// number of filled slots (reader)
+	std::atomic<uint32_t> tail;				// number of released slots (consumer)
+	std::atomic<bool> stop;					// stop the reader thread
+	std::thread reader;
+	bool consuming;							// the slot at "tail" is used by the consumer
+	uint64_t readerWaitNs;					// time the reader waited for a free slot
+	uint64_t consumerWaitNs;				// time the consumer waited for a filled slot
+} configPipe_t;
+
+/*
+*   @brief               Allocate the slots and start the reader thread
+*	@param	pipe		 ring to start
+*	@param	src			 opened configuration source
+*	@param	slotSize	 bytes per slot (CONFIG_PIPE_SLOT_MIN..CONFIG_PIPE_SLOT_MAX,
+*						 multiple of 4)
+*   @return              success; on failure nothing was read from the source
+*/
+bool configPipeStart(configPipe_t* pipe, configSource_t* src, size_t slotSize);
+
+/*
+*   @brief               Release the previous slot and wait for the next filled one
+*						 (alt_fpga_istream_map_t callback)
+*	@param	buf			 returns the slot data
+*	@param	user_data	 configPipe_t of the ring
+*   @return              number of bytes, 0 at the end of the data or -1 on error
+*/
+int32_t configPipeNext(const void** buf, void* user_data);
+
+/*
+*   @brief               Stop the reader thread and free the slots
+*/
+void configPipeStop(configPipe_t* pipe);
+
+#endif // CONFIG_PIPE_H
@@ -0,0 +1,388 @@
+/**
+ *
+ * @file    config_source.cpp
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Sequential source of the FPGA configuration data (raw or compressed rbf file)
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Content hash of the configuration data
+ * 		1.20 (10-16-2026)
+ * 		Optional zstd and lz4 compressed configuration files
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "config_source.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>					// POSIX: open, posix_fadvise
+#include <unistd.h>					// POSIX: read, close
+#include <sys/stat.h>				// POSIX: fstat
+
+#ifdef RSTOOLS_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef RSTOOLS_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef RSTOOLS_WITH_LZ4
+#include <lz4frame.h>
+#endif
+
+using namespace std;
+
+ssize_t readFull(int fd, void* buf, size_t len)
+{
+	uint8_t* ptr = (uint8_t*) buf;
+	size_t done = 0;
+	while (done < len)
+	{
+		ssize_t res = read(fd, ptr + done, len - done);
+		if (res < 0)
+		{
+			if (errno == EINTR) continue;
+			return -1;
+		}
+		if (res == 0) break;
+		done += res;
+	}
+	return done;
+}
+
+#define HASH_OFFSET					0xCBF29CE484222325ULL
+#define HASH_PRIME					0x100000001B3ULL
+
+void configHashInit(configHash_t* hash)
+{
+	hash->hash = HASH_OFFSET;
+	hash->tailLen = 0;
+}
+
+void configHashUpdate(configHash_t* hash, const void* data, size_t len)
+{
+	const uint8_t* ptr = (const uint8_t*) data;
+	uint64_t h = hash->hash;
+	uint64_t word;
+
+	// Complete the word of the previous chunk
+	while ((hash->tailLen > 0) && (len > 0))
+	{
+		hash->tail[hash->tailLen++] = *ptr++;
+		len--;
+		if (hash->tailLen == 8)
+		{
+			memcpy(&word, hash->tail, 8);
+			h = (h ^ word) * HASH_PRIME;
+			hash->tailLen = 0;
+		}
+	}
+
+	// Whole 64-bit words
+	size_t words = len / 8;
+	for (size_t i = 0; i < words; i++)
+	{
+		memcpy(&word, ptr + i*8, 8);
+		h = (h ^ word) * HASH_PRIME;
+	}
+
+	// Keep the remaining bytes for the next chunk
+	for (size_t i = words*8; i < len; i++)
+		hash->tail[hash->tailLen++] = ptr[i];
+	hash->hash = h;
+}
+
+uint64_t configHashFinal(const configHash_t* hash)
+{
+	uint64_t h = hash->hash;
+	for (uint8_t i = 0; i < hash->tailLen; i++)
+		h = (h ^ hash->tail[i]) * HASH_PRIME;
+	return h;
+}
+
+uint64_t configHash64(const void* data, size_t len)
+{
+	configHash_t hash;
+	configHashInit(&hash);
+	configHashUpdate(&hash, data, len);
+	return configHashFinal(&hash);
+}
+
+uint64_t configSourceHash(const configSource_t* src)
+{
+	return configHashFinal(&src->hash);
+}
+
+/*
+*   @brief               Read from the file and ask the kernel to prefetch the
+*						 following CONFIG_PREFETCH_SIZE bytes, so the file is read
+*						 while the FPGA Manager writes the current chunk
+*/
+static ssize_t readFile(configSource_t* src, void* buf, size_t len)
+{
+	off_t target = src->offset + len + CONFIG_PREFETCH_SIZE;
+	if (target > src->size) target = src->size;
+	if (src->prefetched < target)
+	{
+		posix_fadvise(src->fd, src->prefetched, target - src->prefetched, POSIX_FADV_WILLNEED);
+		src->prefetched = target;
+	}
+
+	ssize_t res = readFull(src->fd, buf, len);
+	if (res > 0) src->offset += res;
+	return res;
+}
+
+const char* configFormatName(configFormat_t format)
+{
+	switch (format)
+	{
+		case CONFIG_FORMAT_RAW:  return "raw";
+		case CONFIG_FORMAT_GZIP: return "gzip";
+		case CONFIG_FORMAT_ZSTD: return "zstd";
+		case CONFIG_FORMAT_LZ4:  return "lz4";
+	}
+	return "unknown";
+}
+
+/*
+*   @brief               Detect the format by the magic number of the file
+*/
+static configFormat_t detectFormat(const uint8_t* magic, size_t len)
+{
+	if ((len >= 2) && (magic[0] == 0x1F) && (magic[1] == 0x8B))
+		return CONFIG_FORMAT_GZIP;
+	if ((len >= 4) && (magic[0] == 0x28) && (magic[1] == 0xB5) && (magic[2] == 0x2F) && (magic[3] == 0xFD))
+		return CONFIG_FORMAT_ZSTD;
+	if ((len >= 4) && (magic[0] == 0x04) && (magic[1] == 0x22) && (magic[2] == 0x4D) && (magic[3] == 0x18))
+		return CONFIG_FORMAT_LZ4;
+	return CONFIG_FORMAT_RAW;
+}
+
+bool configSourceOpen(configSource_t* src, const char* fileName)
+{
+	memset(src, 0, sizeof(configSource_t));
+	configHashInit(&src->hash);
+	src->fd = open(fileName, O_RDONLY);
+	if (src->fd < 0) return false;
+
+	struct stat st;
+	fstat(src->fd, &st);
+	src->size = st.st_size;
+	posix_fadvise(src->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+	uint8_t magic[4];
+	ssize_t len = pread(src->fd, magic, sizeof(magic), 0);
+	src->format = detectFormat(magic, (len > 0) ? len : 0);
+
+	if (src->format == CONFIG_FORMAT_RAW)
+		return true;
+
+#ifdef RSTOOLS_WITH_ZLIB
+	if (src->format == CONFIG_FORMAT_GZIP)
+	{
+		z_stream* zs = (z_stream*) calloc(1, sizeof(z_stream));
+		src->input = (uint8_t*) malloc(CONFIG_INPUT_SIZE);
+		// 15 + 32: maximum window with automatic gzip or zlib header detection
+		if ((zs != nullptr) && (src->input != nullptr) && (inflateInit2(zs, 15 + 32) == Z_OK))
+		{
+			src->decoder = zs;
+			return true;
+		}
+		free(zs);
+	}
+#endif
+#ifdef RSTOOLS_WITH_ZSTD
+	if (src->format == CONFIG_FORMAT_ZSTD)
+	{
+		ZSTD_DStream* ds = ZSTD_createDStream();
+		src->input = (uint8_t*) malloc(CONFIG_INPUT_SIZE);
+		if ((ds != nullptr) && (src->input != nullptr) && !ZSTD_isError(ZSTD_initDStream(ds)))
+		{
+			src->decoder = ds;
+			return true;
+		}
+		ZSTD_freeDStream(ds);
+	}
+#endif
+#ifdef RSTOOLS_WITH_LZ4
+	if (src->format == CONFIG_FORMAT_LZ4)
+	{
+		LZ4F_dctx* dctx = nullptr;
+		src->input = (uint8_t*) malloc(CONFIG_INPUT_SIZE);
+		if ((src->input != nullptr) && !LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)))
+		{
+			src->decoder = dctx;
+			return true;
+		}
+	}
+#endif
+
+	configSourceClose(src);
+	return false;
+}
+
+#ifdef RSTOOLS_WITH_ZLIB
+/*
+*   @brief               Decompress the next part of a gzip file
+*/
+static ssize_t readGzip(configSource_t* src, void* buf, size_t len)
+{
+	z_stream* zs = (z_stream*) src->decoder;
+	zs->next_out = (Bytef*) buf;
+	zs->avail_out = len;
+
+	while ((zs->avail_out > 0) && !src->end)
+	{
+		if (zs->avail_in == 0)
+		{
+			ssize_t res = readFile(src, src->input, CONFIG_INPUT_SIZE);
+			if (res < 0) return -1;
+			// The file ends inside the compressed stream
+			if (res == 0) return -1;
+			zs->next_in = src->input;
+			zs->avail_in = res;
+		}
+
+		int ret = inflate(zs, Z_NO_FLUSH);
+		if (ret == Z_STREAM_END)
+		{
+			// gzip files may contain more members (e.g. from "cat a.gz b.gz")
+			if ((zs->avail_in == 0) && (src->offset >= src->size))
+				src->end = true;
+			else if (inflateReset(zs) != Z_OK)
+				return -1;
+		}
+		else if ((ret != Z_OK) && (ret != Z_BUF_ERROR))
+			return -1;
+	}
+
+	return len - zs->avail_out;
+}
+#endif
+
+#if defined(RSTOOLS_WITH_ZSTD) || defined(RSTOOLS_WITH_LZ4)
+/*
+*   @brief               Decompress the next part of a zstd or lz4 file
+*						 (both continue with the next frame of concatenated files)
+*/
+static ssize_t readFrames(configSource_t* src, void* buf, size_t len)
+{
+	uint8_t* out = (uint8_t*) buf;
+	size_t outPos = 0;
+
+	while ((outPos < len) && !src->end)
+	{
+		bool eof = false;
+		if (src->inputPos == src->inputLen)
+		{
+			ssize_t res = readFile(src, src->input, CONFIG_INPUT_SIZE);
+			if (res < 0) return -1;
+			if (res == 0)
+			{
+				if (src->frameEnd)
+				{
+					src->end = true;
+					break;
+				}
+				// Flush the data still buffered in the decoder
+				eof = true;
+			}
+			src->inputPos = 0;
+			src->inputLen = res;
+		}
+
+		size_t before = outPos;
+		size_t ret = 0;
+#ifdef RSTOOLS_WITH_ZSTD
+		if (src->format == CONFIG_FORMAT_ZSTD)
+		{
+			ZSTD_outBuffer zout = { out, len, outPos };
+			ZSTD_inBuffer zin = { src->input, src->inputLen, src->inputPos };
+			ret = ZSTD_decompressStream((ZSTD_DStream*) src->decoder, &zout, &zin);
+			if (ZSTD_isError(ret)) return -1;
+			outPos = zout.pos;
+			src->inputPos = zin.pos;
+		}
+#endif
+#ifdef RSTOOLS_WITH_LZ4
+		if (src->format == CONFIG_FORMAT_LZ4)
+		{
+			size_t dstSize = len - outPos;
+			size_t srcSize = src->inputLen - src->inputPos;
+			ret = LZ4F_decompress((LZ4F_dctx*) src->decoder, out + outPos, &dstSize, \
+				src->input + src->inputPos, &srcSize, nullptr);
+			if (LZ4F_isError(ret)) return -1;
+			outPos += dstSize;
+			src->inputPos += srcSize;
+		}
+#endif
+		// 0: the frame is complete and all its data is returned
+		src->frameEnd = (ret == 0);
+
+		// The file ends inside a frame
+		if (eof && (outPos == before) && !src->frameEnd)
+			return -1;
+	}
+
+	return outPos;
+}
+#endif
+
+ssize_t configSourceRead(configSource_t* src, void* buf, size_t len)
+{
+	ssize_t res = -1;
+	if (src->format == CONFIG_FORMAT_RAW)
+		res = readFile(src, buf, len);
+#ifdef RSTOOLS_WITH_ZLIB
+	else if (src->format == CONFIG_FORMAT_GZIP)
+		res = readGzip(src, buf, len);
+#endif
+#if defined(RSTOOLS_WITH_ZSTD) || defined(RSTOOLS_WITH_LZ4)
+	else if ((src->format == CONFIG_FORMAT_ZSTD) || (src->format == CONFIG_FORMAT_LZ4))
+		res = readFrames(src, buf, len);
+#endif
+
+	if (res > 0)
+	{
+		src->output += res;
+		configHashUpdate(&src->hash, buf, res);
+	}
+	return res;
+}
+
+void configSourceClose(configSource_t* src)
+{
+	if (src->decoder != nullptr)
+	{
+#ifdef RSTOOLS_WITH_ZLIB
+		if (src->format == CONFIG_FORMAT_GZIP)
+		{
+			inflateEnd((z_stream*) src->decoder);
+			free(src->decoder);
+		}
+#endif
+#ifdef RSTOOLS_WITH_ZSTD
+		if (src->format == CONFIG_FORMAT_ZSTD)
+			ZSTD_freeDStream((ZSTD_DStream*) src->decoder);
+#endif
+#ifdef RSTOOLS_WITH_LZ4
+		if (src->format == CONFIG_FORMAT_LZ4)
+			LZ4F_freeDecompressionContext((LZ4F_dctx*) src->decoder);
+#endif
+	}
+	free(src->input);
+	src->decoder = nullptr;
+	src->input = nullptr;
+	if (src->fd >= 0)
+		close(src->fd);
+	src->fd = -1;
+}
@@ -0,0 +1,150 @@
+/**
+ *
+ * @file    config_source.h
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Sequential source of the FPGA configuration data (raw or compressed rbf file)
+ *
+ * The format is detected by the magic number at the beginning of the file.
+ * A raw rbf file is read as it is. A gzip compressed rbf file (.rbf.gz) is
+ * decompressed on the fly with zlib, so the uncompressed image is never
+ * stored completely in memory. Raw rbf files are mostly zeros and shrink
+ * to about a tenth, that is what has to be read from the SD card.
+ *
+ * zstd (.rbf.zst) and lz4 (.rbf.lz4) frames are decompressed the same way
+ * if the build found the libraries (RSTOOLS_WITH_ZSTD, RSTOOLS_WITH_LZ4).
+ * Without zlib (RSTOOLS_WITH_ZLIB not defined) gzip files are rejected,
+ * the same applies to zstd and lz4. Raw files can always be read.
+ *
+ * The source computes a 64-bit content hash of the returned configuration
+ * data while it is read, so a raw and a compressed file of the same image
+ * have the same hash.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Content hash of the configuration data
+ * 		1.20 (10-16-2026)
+ * 		Optional zstd and lz4 compressed configuration files
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef CONFIG_SOURCE_H
+#define CONFIG_SOURCE_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+#include <sys/types.h>				// POSIX: off_t, ssize_t
+
+// Bytes of the file the kernel reads ahead
+#define CONFIG_PREFETCH_SIZE		(1024*1024)
+// Size of the read buffer for the compressed data
+#define CONFIG_INPUT_SIZE			(256*1024)
+
+/*
+* Format of the configuration file
+*/
+typedef enum
+{
+	CONFIG_FORMAT_RAW = 0,			// uncompressed rbf file
+	CONFIG_FORMAT_GZIP = 1,			// gzip (or zlib) compressed rbf file
+	CONFIG_FORMAT_ZSTD = 2,			// zstd frame (RSTOOLS_WITH_ZSTD)
+	CONFIG_FORMAT_LZ4 = 3			// lz4 frame (RSTOOLS_WITH_LZ4)
+} configFormat_t;
+
+/*
+* State of the content hash (FNV-1a on 64-bit words)
+*/
+typedef struct
+{
+	uint64_t hash;
+	uint8_t tail[8];				// bytes of an incomplete word
+	uint8_t tailLen;
+} configHash_t;
+
+/*
+* State of the configuration file source
+*/
+typedef struct
+{
+	int fd;							// configuration file
+	off_t size;						// file size
+	off_t offset;					// bytes read from the file
+	off_t prefetched;				// bytes requested from the kernel
+	configFormat_t format;			// detected format
+	uint64_t output;				// bytes of configuration data returned
+	void* decoder;					// zlib, zstd or lz4 stream of a compressed file
+	uint8_t* input;					// read buffer of a compressed file
+	size_t inputLen;				// bytes in the read buffer (zstd, lz4)
+	size_t inputPos;				// bytes of the read buffer passed to the decoder
+	bool frameEnd;					// the decoder is at the end of a frame (zstd, lz4)
+	bool end;						// end of the compressed stream
+	configHash_t hash;				// content hash of the returned data
+} configSource_t;
+
+/*
+*   @brief               Open a configuration file and detect its format
+*	@param	src			 source to open
+*	@param	fileName	 rbf, rbf.gz, rbf.zst or rbf.lz4 file
+*   @return              success; false if the file can not be read or the
+*						 format is not supported (src->format is set)
+*/
+bool configSourceOpen(configSource_t* src, const char* fileName);
+
+/*
+*   @brief               Read the next part of the configuration data
+*						 (the buffer is filled, only the last part may be shorter)
+*	@param	src			 opened source
+*	@param	buf			 buffer to fill
+*	@param	len			 size of the buffer
+*   @return              number of bytes, 0 at the end of the data or -1 on error
+*/
+ssize_t configSourceRead(configSource_t* src, void* buf, size_t len);
+
+/*
+*   @brief               Close the configuration file
+*/
+void configSourceClose(configSource_t* src);
+
+/*
+*   @brief               Name of a configuration file format ("raw", "gzip", ...)
+*/
+const char* configFormatName(configFormat_t format);
+
+/*
+*   @brief               Content hash of configuration data, independent of the
+*						 chunks the data is passed in
+*/
+void configHashInit(configHash_t* hash);
+void configHashUpdate(configHash_t* hash, const void* data, size_t len);
+uint64_t configHashFinal(const configHash_t* hash);
+
+/*
+*   @brief               64-bit content hash of a complete configuration image
+*	@param	data		 image
+*	@param	len			 bytes of the image
+*   @return              hash
+*/
+uint64_t configHash64(const void* data, size_t len);
+
+/*
+*   @brief               Content hash of all data read from a source so far
+*						 (of the whole image after the end was reached)
+*/
+uint64_t configSourceHash(const configSource_t* src);
+
+/*
+*   @brief               Read until a buffer is full or the end of the file
+*	@param	fd			 file to read
+*	@param	buf			 buffer to fill
+*	@param	len			 size of the buffer
+*   @return              number of bytes or -1 on error
+*/
+ssize_t readFull(int fd, void* buf, size_t len);
+
+#endif // CONFIG_SOURCE_H
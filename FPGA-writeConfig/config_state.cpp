@@ -0,0 +1,117 @@
+/**
+ *
+ * @file    config_state.cpp
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Record of the configuration that was last written to the FPGA
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "config_state.h"
+#include "config_source.h"			// raw or compressed configuration file
+
+#include <cstdlib>
+#include <cstdio>
+#include <climits>
+#include <fstream>
+#include <vector>
+#include <unistd.h>					// POSIX: unlink
+#include <sys/stat.h>				// POSIX: stat, mkdir
+
+using namespace std;
+
+bool configStateIdentify(configState_t* state, const char* fileName)
+{
+	char path[PATH_MAX];
+	struct stat st;
+	if ((realpath(fileName, path) == nullptr) || (stat(path, &st) != 0))
+		return false;
+
+	state->path = path;
+	state->fileSize = st.st_size;
+	state->fileMtime = (int64_t) st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+	state->fileIno = st.st_ino;
+	return true;
+}
+
+bool configStateRead(configState_t* state)
+{
+	ifstream file(CONFIG_STATE_FILE);
+	if (!file.good()) return false;
+
+	// All keys must be present
+	uint8_t found = 0;
+	string line;
+	while (getline(file, line))
+	{
+		size_t eq = line.find('=');
+		if (eq == string::npos) continue;
+		string key = line.substr(0, eq);
+		string value = line.substr(eq + 1);
+
+		if (key == "hash")			{ state->hash = strtoull(value.c_str(), nullptr, 16); found |= 0x01; }
+		else if (key == "bytes")	{ state->bytes = strtoull(value.c_str(), nullptr, 10); found |= 0x02; }
+		else if (key == "path")		{ state->path = value; found |= 0x04; }
+		else if (key == "size")		{ state->fileSize = strtoull(value.c_str(), nullptr, 10); found |= 0x08; }
+		else if (key == "mtime")	{ state->fileMtime = strtoll(value.c_str(), nullptr, 10); found |= 0x10; }
+		else if (key == "inode")	{ state->fileIno = strtoull(value.c_str(), nullptr, 10); found |= 0x20; }
+		else if (key == "time")		{ state->time = strtoll(value.c_str(), nullptr, 10); found |= 0x40; }
+	}
+	return (found == 0x7F);
+}
+
+bool configStateWrite(const configState_t* state)
+{
+	mkdir(CONFIG_STATE_DIR, 0755);
+
+	// Write a temporary file and rename it, a reader never sees a partial record
+	string tmp = string(CONFIG_STATE_FILE) + ".tmp";
+	{
+		ofstream file(tmp, ios::out | ios::trunc);
+		if (!file.is_open()) return false;
+		file << "hash=" << hex << state->hash << dec << endl;
+		file << "bytes=" << state->bytes << endl;
+		file << "path=" << state->path << endl;
+		file << "size=" << state->fileSize << endl;
+		file << "mtime=" << state->fileMtime << endl;
+		file << "inode=" << state->fileIno << endl;
+		file << "time=" << state->time << endl;
+		file.flush();
+		if (!file.good())
+		{
+			file.close();
+			unlink(tmp.c_str());
+			return false;
+		}
+	}
+	return (rename(tmp.c_str(), CONFIG_STATE_FILE) == 0);
+}
+
+void configStateClear(void)
+{
+	unlink(CONFIG_STATE_FILE);
+}
+
+bool configStateHashFile(const char* fileName, uint64_t* hash, uint64_t* bytes)
+{
+	configSource_t src;
+	if (!configSourceOpen(&src, fileName))
+		return false;
+
+	vector<uint8_t> buf(CONFIG_INPUT_SIZE);
+	ssize_t res;
+	while ((res = configSourceRead(&src, buf.data(), buf.size())) > 0) {}
+
+	*hash = configSourceHash(&src);
+	*bytes = src.output;
+	configSourceClose(&src);
+	return (res == 0);
+}
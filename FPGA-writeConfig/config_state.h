@@ -0,0 +1,88 @@
+/**
+ *
+ * @file    config_state.h
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Record of the configuration that was last written to the FPGA
+ *
+ * After a successful configuration the content hash and the identity of the
+ * file are stored in /run/rstools/fpga-config.state (one "key=value" per
+ * line, readable by scripts). Before a new configuration is written the record
+ * is removed, so a failed or aborted configuration never leaves a record.
+ * /run is a tmpfs, the record does not survive a reboot (the bootloader
+ * writes its own configuration).
+ *
+ * A configuration written by another tool (e.g. a device tree overlay) does
+ * not update the record.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef CONFIG_STATE_H
+#define CONFIG_STATE_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <string>
+
+// Record of the last configuration
+#define CONFIG_STATE_DIR			"/run/rstools"
+#define CONFIG_STATE_FILE			CONFIG_STATE_DIR "/fpga-config.state"
+
+/*
+* Last written configuration
+*/
+typedef struct
+{
+	uint64_t hash;					// content hash of the configuration data
+	uint64_t bytes;					// bytes of the configuration data
+	std::string path;				// canonical path of the file
+	uint64_t fileSize;				// size of the file
+	int64_t fileMtime;				// modification time of the file in ns
+	uint64_t fileIno;				// inode of the file
+	int64_t time;					// UNIX time of the configuration
+} configState_t;
+
+/*
+*   @brief               Fill in the identity (path, size, mtime, inode) of a file
+*	@param	state		 record to fill
+*	@param	fileName	 configuration file
+*   @return              success
+*/
+bool configStateIdentify(configState_t* state, const char* fileName);
+
+/*
+*   @brief               Read the record of the last configuration
+*	@param	state		 read record
+*   @return              true if a complete record exists
+*/
+bool configStateRead(configState_t* state);
+
+/*
+*   @brief               Write the record of a configuration (atomically)
+*	@param	state		 record to write
+*   @return              success
+*/
+bool configStateWrite(const configState_t* state);
+
+/*
+*   @brief               Remove the record (before a new configuration is written)
+*/
+void configStateClear(void);
+
+/*
+*   @brief               Content hash of the configuration data of a file
+*	@param	fileName	 rbf or rbf.gz file
+*	@param	hash		 content hash
+*	@param	bytes		 bytes of the configuration data
+*   @return              success
+*/
+bool configStateHashFile(const char* fileName, uint64_t* hash, uint64_t* bytes);
+
+#endif // CONFIG_STATE_H
@@ -0,0 +1,372 @@
+/**
+ *
+ * @file    fpga_dma.cpp
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * DMA transfer of the FPGA configuration with the HPS DMA Controller (ARM PL330)
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "fpga_dma.h"
+#include "hwlib.h"					// ALT_STATUS_CODE error codes
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_time.h"			// rstools timestamps
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <fstream>
+#include <sys/mman.h>				// POSIX: memory maping
+#include <fcntl.h>					// POSIX: "PROT_WRITE", "MAP_SHARED", ...
+#include <unistd.h>					// POSIX: for closing the Linux driver access
+
+using namespace std;
+
+// PL330 register offsets
+#define DMAC_CSR(ch)		(0x100 + (ch)*8)	// Channel Status Register
+#define DMAC_FTR(ch)		(0x040 + (ch)*4)	// Fault Type Register
+#define DMAC_DBGSTATUS		0xD00
+#define DMAC_DBGCMD			0xD04
+#define DMAC_DBGINST0		0xD08
+#define DMAC_DBGINST1		0xD0C
+
+// PL330 channel states of the CSR
+#define DMAC_CS_STOPPED		0x0
+#define DMAC_CS_FAULTING	0xF
+
+// PL330 instructions
+#define DMA_END				0x00
+#define DMA_KILL			0x01
+#define DMA_LD				0x04
+#define DMA_ST				0x08
+#define DMA_RMB				0x12
+#define DMA_WMB				0x13
+#define DMA_LP				0x20	// | lc << 1
+#define DMA_LPEND			0x38	// | lc << 2
+#define DMA_GO				0xA0
+#define DMA_MOV				0xBC
+
+// DMAMOV destination registers
+#define DMA_MOV_SAR			0
+#define DMA_MOV_CCR			1
+#define DMA_MOV_DAR			2
+
+// Channel Control Register: 4 Byte beats, incrementing source, fixed destination
+#define CCR_SRC_INC			(1 << 0)
+#define CCR_SRC_SIZE_4		(2 << 1)
+#define CCR_SRC_LEN(n)		(((n)-1) << 4)
+#define CCR_SRC_PRIV		(1 << 8)
+#define CCR_DST_INC			(1 << 14)
+#define CCR_DST_SIZE_4		(2 << 15)
+#define CCR_DST_LEN(n)		(((n)-1) << 18)
+#define CCR_DST_PRIV		(1 << 22)
+
+#define DMA_BURST_LEN		16		// Beats per burst
+#define DMA_LOOP_MAX		256		// Maximum iterations of a DMALP
+
+/*
+* Emit one instruction with an optional 32-bit immediate
+*/
+static void emit(vector<uint8_t>& prog, uint8_t b0)
+{
+	prog.push_back(b0);
+}
+
+static void emit(vector<uint8_t>& prog, uint8_t b0, uint8_t b1)
+{
+	prog.push_back(b0);
+	prog.push_back(b1);
+}
+
+static void emitMov(vector<uint8_t>& prog, uint8_t rd, uint32_t imm)
+{
+	emit(prog, DMA_MOV, rd);
+	for (uint8_t i = 0; i < 4; i++)
+		prog.push_back((imm >> (8*i)) & 0xFF);
+}
+
+/*
+* Emit "count" times DMALD + DMAST with the loop counter lc (count <= DMA_LOOP_MAX)
+* inside an optional outer loop of "outer" iterations
+*/
+static void emitTransfers(vector<uint8_t>& prog, uint32_t outer, uint32_t count)
+{
+	size_t outerStart = 0;
+	if (outer > 1)
+	{
+		emit(prog, DMA_LP | (0 << 1), outer - 1);
+		outerStart = prog.size();
+	}
+
+	emit(prog, DMA_LP | (1 << 1), count - 1);
+	size_t innerStart = prog.size();
+	emit(prog, DMA_LD);
+	emit(prog, DMA_ST);
+	emit(prog, DMA_LPEND | (1 << 2), prog.size() - innerStart);
+
+	if (outer > 1)
+		emit(prog, DMA_LPEND | (0 << 2), prog.size() - outerStart);
+}
+
+void fpgaDmaBuildProgram(vector<uint8_t>& prog, uint32_t src, uint32_t dst, uint32_t length)
+{
+	uint32_t ccrBase = CCR_SRC_INC | CCR_SRC_SIZE_4 | CCR_SRC_PRIV | CCR_DST_SIZE_4 | CCR_DST_PRIV;
+	uint32_t bursts = length / (DMA_BURST_LEN*4);
+	uint32_t words  = (length % (DMA_BURST_LEN*4)) / 4;
+
+	prog.clear();
+	emitMov(prog, DMA_MOV_SAR, src);
+	emitMov(prog, DMA_MOV_DAR, dst);
+
+	// Complete bursts of 16 words
+	if (bursts > 0)
+	{
+		emitMov(prog, DMA_MOV_CCR, ccrBase | CCR_SRC_LEN(DMA_BURST_LEN) | CCR_DST_LEN(DMA_BURST_LEN));
+
+		uint32_t blocks = bursts / DMA_LOOP_MAX;
+		while (blocks > 0)
+		{
+			uint32_t outer = (blocks > DMA_LOOP_MAX) ? DMA_LOOP_MAX : blocks;
+			emitTransfers(prog, outer, DMA_LOOP_MAX);
+			blocks -= outer;
+		}
+		if (bursts % DMA_LOOP_MAX)
+			emitTransfers(prog, 1, bursts % DMA_LOOP_MAX);
+	}
+
+	// Remaining single words
+	if (words > 0)
+	{
+		emitMov(prog, DMA_MOV_CCR, ccrBase | CCR_SRC_LEN(1) | CCR_DST_LEN(1));
+		emitTransfers(prog, 1, words);
+	}
+
+	emit(prog, DMA_WMB);
+	emit(prog, DMA_END);
+}
+
+bool fpgaDmaSimulate(const vector<uint8_t>& prog, const uint8_t* mem, uint32_t memPhys,
+	size_t memLength, uint32_t dst, vector<uint32_t>& written)
+{
+	uint32_t sar = 0, dar = 0, ccr = 0;
+	uint32_t lc[2] = {0, 0};
+	vector<uint32_t> mfifo;
+	size_t pc = 0;
+
+	while (pc < prog.size())
+	{
+		uint8_t op = prog[pc];
+
+		if (op == DMA_END)
+			return mfifo.empty();
+		else if ((op == DMA_RMB) || (op == DMA_WMB))
+			pc++;
+		else if (op == DMA_MOV)
+		{
+			if (pc + 6 > prog.size()) return false;
+			uint32_t imm = prog[pc+2] | (prog[pc+3] << 8) | (prog[pc+4] << 16) | ((uint32_t) prog[pc+5] << 24);
+			if (prog[pc+1] == DMA_MOV_SAR) sar = imm;
+			else if (prog[pc+1] == DMA_MOV_CCR) ccr = imm;
+			else if (prog[pc+1] == DMA_MOV_DAR) dar = imm;
+			else return false;
+			pc += 6;
+		}
+		else if ((op & 0xFD) == DMA_LP)
+		{
+			if (pc + 2 > prog.size()) return false;
+			lc[(op >> 1) & 1] = prog[pc+1];
+			pc += 2;
+		}
+		else if ((op & 0xFB) == DMA_LPEND)
+		{
+			if (pc + 2 > prog.size()) return false;
+			uint32_t& counter = lc[(op >> 2) & 1];
+			if (counter > 0)
+			{
+				counter--;
+				if (prog[pc+1] > pc) return false;
+				pc -= prog[pc+1];
+			}
+			else
+				pc += 2;
+		}
+		else if ((op == DMA_LD) || (op == DMA_ST))
+		{
+			bool load = (op == DMA_LD);
+			uint32_t size = 1 << ((ccr >> (load ? 1 : 15)) & 0x7);
+			uint32_t len  = ((ccr >> (load ? 4 : 18)) & 0xF) + 1;
+			bool inc = ccr & (load ? CCR_SRC_INC : CCR_DST_INC);
+			if (size != 4) return false;
+
+			for (uint32_t i = 0; i < len; i++)
+			{
+				if (load)
+				{
+					// Only the memory image can be read
+					if ((sar < memPhys) || ((uint64_t) sar + 4 > (uint64_t) memPhys + memLength)) return false;
+					uint32_t value;
+					memcpy(&value, mem + (sar - memPhys), 4);
+					mfifo.push_back(value);
+					if (inc) sar += 4;
+				}
+				else
+				{
+					// Only the register can be written
+					if ((dar != dst) || mfifo.empty()) return false;
+					written.push_back(mfifo.front());
+					mfifo.erase(mfifo.begin());
+					if (inc) dar += 4;
+				}
+			}
+			pc++;
+		}
+		else
+			return false;
+	}
+
+	// The program must end with DMAEND
+	return false;
+}
+
+/*
+*   @brief               Read a value of the sysfs attributes of the u-dma-buf driver
+*   @param	name		 buffer name
+*   @param	attr		 attribute ("phys_addr" or "size")
+*   @param	value		 read value
+*   @return              success
+*/
+static bool readDmaBufAttr(const string& name, const char* attr, uint64_t* value)
+{
+	const char* classes[] = {"/sys/class/u-dma-buf/", "/sys/class/udmabuf/"};
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		ifstream file(string(classes[i]) + name + "/" + attr);
+		string text;
+		if (file.good() && (file >> text))
+		{
+			*value = strtoull(text.c_str(), nullptr, 0);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool fpgaDmaOpen(fpgaDma_t* dma)
+{
+	const char* name = getenv(FPGADMA_ENV_BUF);
+	if ((name == nullptr) || (name[0] == '\0'))
+		name = FPGADMA_DEFAULT_BUF;
+
+	dma->fd = -1;
+	dma->virt = nullptr;
+	dma->channel = FPGADMA_DEFAULT_CHANNEL;
+
+	uint64_t phys, size;
+	if (!readDmaBufAttr(name, "phys_addr", &phys) || !readDmaBufAttr(name, "size", &size))
+		return false;
+	// The DMA Controller can only address the 32-bit space
+	if ((phys + size) > 0x100000000ULL) return false;
+	dma->phys = (uint32_t) phys;
+	dma->size = size;
+
+	// O_SYNC: uncached mapping, the data is in memory when the DMA starts
+	dma->fd = open((string("/dev/") + name).c_str(), (O_RDWR | O_SYNC));
+	if (dma->fd < 0) return false;
+
+	void* map = mmap(NULL, dma->size, (PROT_READ | PROT_WRITE), MAP_SHARED, dma->fd, 0);
+	if (map == MAP_FAILED)
+	{
+		close(dma->fd);
+		dma->fd = -1;
+		return false;
+	}
+	dma->virt = (uint8_t*) map;
+	return true;
+}
+
+void fpgaDmaClose(fpgaDma_t* dma)
+{
+	if (dma->virt != nullptr)
+		munmap(dma->virt, dma->size);
+	if (dma->fd >= 0)
+		close(dma->fd);
+	dma->virt = nullptr;
+	dma->fd = -1;
+}
+
+/*
+*   @brief               Execute an instruction with the debug interface of the DMA Controller
+*   @param	dmac		 mapped DMA Controller
+*   @param	inst0		 DBGINST0 (first two instruction bytes and thread)
+*   @param	inst1		 DBGINST1 (instruction bytes 2 to 5)
+*   @return              success
+*/
+static bool dmaDebugExec(volatile uint32_t* dmac, uint32_t inst0, uint32_t inst1)
+{
+	uint64_t deadline = rsTimeNowNs() + 1000000ULL;
+	while (dmac[DMAC_DBGSTATUS/4] & 0x1)
+	{
+		if (rsTimeNowNs() > deadline) return false;
+	}
+
+	dmac[DMAC_DBGINST0/4] = inst0;
+	dmac[DMAC_DBGINST1/4] = inst1;
+	__sync_synchronize();
+	dmac[DMAC_DBGCMD/4] = 0;
+	return true;
+}
+
+int fpgaDmaTransfer(fpgaDma_t* dma, const void* buf, size_t length, uint32_t dst)
+{
+	const uint8_t* data = (const uint8_t*) buf;
+	if ((data < dma->virt + FPGADMA_PROG_SIZE) || (data + length > dma->virt + dma->size))
+		return ALT_E_BAD_ARG;
+	if (length == 0) return ALT_E_SUCCESS;
+
+	// The program is placed at the beginning of the buffer
+	vector<uint8_t> prog;
+	fpgaDmaBuildProgram(prog, dma->phys + (uint32_t)(data - dma->virt), dst, (uint32_t) length);
+	if (prog.size() > FPGADMA_PROG_SIZE) return ALT_E_BUF_OVF;
+	memcpy(dma->virt, prog.data(), prog.size());
+
+	volatile uint32_t* dmac = rsMemMap(FPGADMA_DMAC_BASE, MAP_SIZE);
+	if (dmac == nullptr) return ALT_E_ERROR;
+
+	// The channel must not be used by someone else
+	uint8_t ch = dma->channel;
+	if ((dmac[DMAC_CSR(ch)/4] & 0xF) != DMAC_CS_STOPPED) return ALT_E_BAD_OPERATION;
+
+	// DMAGO <channel>, <program address> from the manager thread
+	if (!dmaDebugExec(dmac, ((uint32_t) ch << 24) | (DMA_GO << 16), dma->phys))
+		return ALT_E_TMO;
+
+	// Wait until the channel stopped at the DMAEND
+	uint64_t deadline = rsTimeNowNs() + FPGADMA_TIMEOUT_MS*1000000ULL;
+	while (dmac[DMAC_DBGSTATUS/4] & 0x1)
+	{
+		// The debug interface did not take the DMAGO (a DMAKILL would not be taken either)
+		if (rsTimeNowNs() > deadline) return ALT_E_TMO;
+	}
+	for (;;)
+	{
+		uint32_t state = dmac[DMAC_CSR(ch)/4] & 0xF;
+		if (state == DMAC_CS_STOPPED) break;
+		if ((state == DMAC_CS_FAULTING) || (rsTimeNowNs() > deadline))
+		{
+			// DMAKILL on the channel thread
+			dmaDebugExec(dmac, (DMA_KILL << 16) | ((uint32_t) ch << 8) | 0x1, 0);
+			return (state == DMAC_CS_FAULTING) ? ALT_E_ERROR : ALT_E_TMO;
+		}
+		usleep(100);
+	}
+
+	return (dmac[DMAC_FTR(ch)/4] == 0) ? ALT_E_SUCCESS : ALT_E_ERROR;
+}
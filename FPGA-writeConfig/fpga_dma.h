@@ -0,0 +1,110 @@
+/**
+ *
+ * @file    fpga_dma.h
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * DMA transfer of the FPGA configuration with the HPS DMA Controller (ARM PL330)
+ *
+ * The configuration image is placed in a physically contiguous buffer of the
+ * u-dma-buf driver (CMA memory, /dev/udmabuf0). A PL330 program with 16 beat
+ * bursts moves the image from this buffer to the FPGA Manager data register.
+ * The program is started over the debug interface of the DMA manager thread.
+ *
+ * The generated programs can be checked without hardware with the simulated
+ * backend (fpgaDmaSimulate), which executes the program on a memory image and
+ * records every word that reaches the data register.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef FPGA_DMA_H
+#define FPGA_DMA_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+#include <vector>
+
+// HPS DMA Controller (secure) and FPGA Manager data register
+#define FPGADMA_DMAC_BASE			0xFFE01000
+#define FPGADMA_FPGAMGRDATA			0xFFB90000
+
+// Default DMA channel (the Linux pl330 driver allocates the channels from 0)
+#define FPGADMA_DEFAULT_CHANNEL		7
+
+// u-dma-buf device with the physically contiguous buffer
+#define FPGADMA_DEFAULT_BUF			"udmabuf0"
+#define FPGADMA_ENV_BUF				"RSTOOLS_DMABUF"
+
+// Space at the beginning of the buffer for the DMA program
+#define FPGADMA_PROG_SIZE			4096
+
+// Timeout of a DMA transfer
+#define FPGADMA_TIMEOUT_MS			5000
+
+/*
+* Physically contiguous DMA buffer
+*/
+typedef struct
+{
+	int fd;							// u-dma-buf device
+	uint8_t* virt;					// mapped buffer
+	uint32_t phys;					// physical address of the buffer
+	size_t size;					// buffer size
+	uint8_t channel;				// DMA channel to use
+} fpgaDma_t;
+
+/*
+*   @brief               Build a PL330 program that moves a memory range to a
+*						 fixed 32-bit register with 16 beat bursts
+*   @param	prog		 generated program
+*   @param	src			 physical source address (32-bit aligned)
+*   @param	dst			 physical address of the register
+*   @param	length		 number of bytes (multiple of 4)
+*/
+void fpgaDmaBuildProgram(std::vector<uint8_t>& prog, uint32_t src, uint32_t dst, uint32_t length);
+
+/*
+*   @brief               Simulated DMA backend: execute a PL330 program on a memory image
+*   @param	prog		 program to execute
+*   @param	mem			 memory image
+*   @param	memPhys		 physical address of the memory image
+*   @param	memLength	 size of the memory image
+*   @param	dst			 physical address of the register
+*   @param	written		 all words that were written to the register
+*   @return              true if the program ended with DMAEND and accessed only
+*						 the memory image and the register
+*/
+bool fpgaDmaSimulate(const std::vector<uint8_t>& prog, const uint8_t* mem, uint32_t memPhys,
+	size_t memLength, uint32_t dst, std::vector<uint32_t>& written);
+
+/*
+*   @brief               Open and map the u-dma-buf buffer
+*						 (name from RSTOOLS_DMABUF or FPGADMA_DEFAULT_BUF)
+*   @param	dma			 opened buffer
+*   @return              success
+*/
+bool fpgaDmaOpen(fpgaDma_t* dma);
+
+/*
+*   @brief               Unmap and close the u-dma-buf buffer
+*/
+void fpgaDmaClose(fpgaDma_t* dma);
+
+/*
+*   @brief               Move a part of the buffer to a register with the DMA Controller
+*   @param	dma			 opened buffer
+*   @param	buf			 data inside the mapped buffer (32-bit aligned)
+*   @param	length		 number of bytes (multiple of 4)
+*   @param	dst			 physical address of the register
+*   @return              0 (ALT_E_SUCCESS) or a negative HWLIB error code
+*/
+int fpgaDmaTransfer(fpgaDma_t* dma, const void* buf, size_t length, uint32_t dst);
+
+#endif // FPGA_DMA_H
@@ -0,0 +1,131 @@
+/**
+ *
+ * @file    fpga_dma_test.cpp
+ * @brief   FPGA-writeConfig
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Test of the generated PL330 programs with the simulated DMA backend
+ *
+ * Every program is built with fpgaDmaBuildProgram for a memory image with a
+ * known pattern, executed with fpgaDmaSimulate and the words that reached the
+ * data register are compared with the image. The lengths cover single words,
+ * partial and complete bursts, the inner loop limit and more than one
+ * outer loop. No hardware is accessed.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "fpga_dma.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+// Physical address of the simulated DMA buffer
+#define TEST_BUF_PHYS		0x30000000
+
+/*
+*   @brief               Simulate the transfer of "length" bytes and compare the output
+*   @param	length		 number of bytes (multiple of 4)
+*   @return              success
+*/
+static bool checkTransfer(uint32_t length)
+{
+	// The program is placed in front of the data like in the real buffer
+	vector<uint8_t> mem(FPGADMA_PROG_SIZE + length);
+	vector<uint32_t> input(length / 4);
+	for (size_t i = 0; i < input.size(); i++)
+		input[i] = (uint32_t) (i * 0x9E3779B9u) ^ length;
+	memcpy(mem.data() + FPGADMA_PROG_SIZE, input.data(), length);
+
+	vector<uint8_t> prog;
+	fpgaDmaBuildProgram(prog, TEST_BUF_PHYS + FPGADMA_PROG_SIZE, FPGADMA_FPGAMGRDATA, length);
+
+	vector<uint32_t> written;
+	if (prog.size() > FPGADMA_PROG_SIZE)
+	{
+		printf("[ ERROR ] %u Bytes: program with %zu Bytes does not fit\n", length, prog.size());
+		return false;
+	}
+	if (!fpgaDmaSimulate(prog, mem.data(), TEST_BUF_PHYS, mem.size(), FPGADMA_FPGAMGRDATA, written))
+	{
+		printf("[ ERROR ] %u Bytes: the simulated DMA rejected the program\n", length);
+		return false;
+	}
+	if (written != input)
+	{
+		printf("[ ERROR ] %u Bytes: %zu of %zu words written, the output differs\n", length, \
+			written.size(), input.size());
+		return false;
+	}
+	return true;
+}
+
+/*
+*   @brief               The simulator must reject a program that leaves the memory image
+*						 or writes another register
+*   @return              success
+*/
+static bool checkRejected(void)
+{
+	vector<uint8_t> mem(FPGADMA_PROG_SIZE + 256);
+	vector<uint8_t> prog;
+	vector<uint32_t> written;
+
+	// Source behind the end of the image
+	fpgaDmaBuildProgram(prog, TEST_BUF_PHYS + FPGADMA_PROG_SIZE, FPGADMA_FPGAMGRDATA, 512);
+	if (fpgaDmaSimulate(prog, mem.data(), TEST_BUF_PHYS, mem.size(), FPGADMA_FPGAMGRDATA, written))
+	{
+		printf("[ ERROR ] A read behind the memory image was accepted\n");
+		return false;
+	}
+
+	// Wrong destination register
+	written.clear();
+	fpgaDmaBuildProgram(prog, TEST_BUF_PHYS + FPGADMA_PROG_SIZE, FPGADMA_FPGAMGRDATA + 4, 256);
+	if (fpgaDmaSimulate(prog, mem.data(), TEST_BUF_PHYS, mem.size(), FPGADMA_FPGAMGRDATA, written))
+	{
+		printf("[ ERROR ] A write to another register was accepted\n");
+		return false;
+	}
+
+	// Program without DMAEND
+	written.clear();
+	fpgaDmaBuildProgram(prog, TEST_BUF_PHYS + FPGADMA_PROG_SIZE, FPGADMA_FPGAMGRDATA, 256);
+	prog.pop_back();
+	if (fpgaDmaSimulate(prog, mem.data(), TEST_BUF_PHYS, mem.size(), FPGADMA_FPGAMGRDATA, written))
+	{
+		printf("[ ERROR ] A program without DMAEND was accepted\n");
+		return false;
+	}
+	return true;
+}
+
+int main(void)
+{
+	// 64 Byte per burst, 256 bursts per inner loop
+	const uint32_t burst = 16*4;
+	const uint32_t loop  = 256*burst;
+	const uint32_t lengths[] =
+	{
+		4, 60, burst, burst + 4, 3*burst + 12,
+		loop - burst, loop, loop + 4, 3*loop + 5*burst + 8,
+		256*loop, 257*loop + 300*burst + 60
+	};
+
+	bool ok = true;
+	for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++)
+		ok = checkTransfer(lengths[i]) && ok;
+	ok = checkRejected() && ok;
+
+	printf(ok ? "[ SUCCESS ] All simulated DMA transfers are correct\n" : "[ ERROR ] Simulated DMA test failed\n");
+	return ok ? 0 : 1;
+}
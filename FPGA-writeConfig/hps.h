@@ -55,15 +55,19 @@ extern volatile void* __hps_virtualAdreess_FPGAMGR;
 extern volatile void* __hps_virtualAdreess_FPGAMFRDATA;
 extern volatile int __fd;
 	
+/* Mapped window of the FPGA Manager data aperture. Every address of the
+ * window writes to the data register, this allows burst writes. */
+#define ALT_FPGAMGRDATA_APERTURE    0x1000
+
 #ifdef LINUX_TASK_MODE 
 
     #define __VIRTUALMEM_SPACE_INIT()             \
         __fd = open("/dev/mem", (O_RDWR | O_SYNC));   \
-	    __hps_virtualAdreess_FPGAMFRDATA  = mmap(NULL, 0x04,(PROT_READ | PROT_WRITE), MAP_SHARED, __fd, ALT_FPGAMGRDATA_OFST);      \
+	    __hps_virtualAdreess_FPGAMFRDATA  = mmap(NULL, ALT_FPGAMGRDATA_APERTURE,(PROT_READ | PROT_WRITE), MAP_SHARED, __fd, ALT_FPGAMGRDATA_OFST);      \
 	    __hps_virtualAdreess_FPGAMGR = mmap(NULL, 0x1000,(PROT_READ | PROT_WRITE), MAP_SHARED, __fd, ALT_FPGAMGR_OFST)             
 
     #define __VIRTUALMEM_SPACE_DEINIT()                                                                                           \
-            munmap((void*) __hps_virtualAdreess_FPGAMFRDATA, 0x04);                                                               \
+            munmap((void*) __hps_virtualAdreess_FPGAMFRDATA, ALT_FPGAMGRDATA_APERTURE);                                           \
             munmap((void*) __hps_virtualAdreess_FPGAMGR, 0x1000);                                                                 \
             close(__fd)
 
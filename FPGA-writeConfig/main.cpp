@@ -10,12 +10,32 @@
  * Change Log:  
  * 		1.00 (03-08-2022)
  * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Stream the rbf file in large chunks instead of loading it at once
+ * 		1.20 (10-16-2026)
+ * 		DMA mode with the HPS DMA Controller and a simulated DMA check
+ * 		1.30 (10-16-2026)
+ * 		Timing report of the configuration steps (JSON or binary)
+ * 		1.40 (10-16-2026)
+ * 		Time-based deadlines with backoff for the FPGA Manager polling loops
+ * 		and wait statistics in the timing report
+ * 		1.50 (10-16-2026)
+ * 		gzip compressed configuration files (.rbf.gz) with streaming decompression
+ * 		1.60 (10-16-2026)
+ * 		Reader thread with a ring of large buffers for the istream configuration
+ * 		and a benchmark of the configuration data paths with a simulated data port
+ * 		1.70 (10-16-2026)
+ * 		Bitstream cache in shared memory for configurations without file I/O
+ * 		1.80 (10-16-2026)
+ * 		Skip the configuration if the FPGA already runs the same configuration
+ * 		1.90 (10-16-2026)
+ * 		Write the configuration over the rstoolsd daemon if RSTOOLS_SOCKET is set
  * 
  * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
  * 
  */
 
-#define VERSION "1.00"
+#define VERSION "1.90"
 
 extern "C"
 {
@@ -32,9 +52,77 @@ volatile int __fd;
 #include <iostream>
 #include <thread>					// Required for putting task to sleep 
 #include <chrono>					// Required for putting task to sleep 
+#include <cerrno>
+#include <cstdlib>
+#include <ctime>
+#include <fcntl.h>					// POSIX: open, posix_fadvise
+#include <unistd.h>					// POSIX: read, close
+#include <sys/stat.h>				// POSIX: fstat
+#include <sys/mman.h>				// POSIX: mlock
+#include <vector>
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_time.h"			// rstools timestamps
+#include "rstools_client.h"			// rstoolsd daemon
+#include "fpga_dma.h"				// DMA transfer of the FPGA configuration
+#include "config_source.h"			// raw or compressed configuration file
+#include "config_pipe.h"				// reader thread of the configuration file
+#include "config_cache.h"			// bitstream cache in shared memory
+#include "config_state.h"			// record of the last configuration
 
 using namespace std;
 
+/*
+* Timing report of a configuration (-trace: JSON, -tracebin: binary)
+*/
+typedef struct
+{
+	ALT_FPGA_TRACE_t fpga;			// steps of the FPGA Manager
+	uint64_t start_ns;				// writeFPGAconfig called
+	uint64_t load_ns;				// loading the file into the DMA buffer
+	uint64_t reset_ns;				// bridge and cold reset after the configuration
+	uint64_t end_ns;				// writeFPGAconfig finished
+	uint64_t file_size;				// size of the rbf file
+	configFormat_t format;			// format of the rbf file
+	bool dma;						// written with the DMA Controller
+	int8_t cache;					// configCacheResult_t or -1: not cached
+	bool skipped;					// the FPGA already ran the configuration
+} configReport_t;
+
+// Binary timing report (little endian, all times in ns relative to the start)
+#define CONFIG_REPORT_MAGIC			"RSCT"
+#define CONFIG_REPORT_VERSION		5
+
+typedef struct __attribute__((packed))
+{
+	char magic[4];					// "RSCT"
+	uint32_t version;				// CONFIG_REPORT_VERSION
+	uint64_t step_ns[ALT_FPGA_TRACE_STEPS];	// FPGA Manager steps (0: not reached)
+	uint64_t stream_ns;				// time in the file reading callback
+	uint64_t write_ns;				// time writing the AXI data register
+	uint64_t load_ns;				// time loading the file into the DMA buffer
+	uint64_t reset_ns;				// time of the resets after the configuration
+	uint64_t total_ns;				// total time of writeFPGAconfig
+	uint64_t bytes;					// configuration bytes written
+	uint64_t file_size;				// size of the rbf file
+	uint32_t chunks;				// number of chunks
+	int32_t status;					// ALT_STATUS_CODE of the configuration
+	uint32_t dma;					// 1: written with the DMA Controller
+	ALT_FPGA_WAIT_STATS_t wait[ALT_FPGA_WAITS];	// polling loops (version 2)
+	uint32_t format;				// configFormat_t of the rbf file (version 3)
+	int32_t cache;					// configCacheResult_t or -1: not cached (version 4)
+	uint32_t skipped;				// 1: the FPGA already ran the configuration (version 5)
+} configReportRecord_t;
+
+// Benchmark of the configuration data paths (-pipesim)
+#define PIPESIM_ISTREAM_CHUNK		(128*512)	// ISTREAM_CHUNK_SIZE of the FPGA Manager
+#define PIPESIM_DEFAULT_RATE		100			// MB/s of the simulated data port
+
+// Reset Manager Bridge Module Reset Register (HPS2FPGA, LWHPS2FPGA, FPGA2HPS)
+#define REG_RSTMGR_BRGMODRST		0xFFD0501C
+#define REG_RSTMGR_BRGMODRST_ALL	0x7
+// Reset Manager Miscellaneous Module Reset Register (h2f_rst_n, h2f_cold_rst_n)
+#define REG_RSTMGR_MISCMODRST		0xFFD05020
+
 
 bool is_file_exist(const char* fileName)
 {
@@ -52,6 +140,7 @@ bool is_file_exist(const char* fileName)
 *							3 = LW HPS-to-FPGA Bridge Reset
 *							4 = HPS-to-FPGA Bridge Reset
 *							5 = FPGA-to-HPS Bridge Reset
+*							6 = Reset of all HPS<>FPGA Bridges
 *   @return                 success  
 */ 
 bool performHPStoFPGAReset(bool ConsloeOutput, uint8_t reset_typ)
@@ -67,21 +156,34 @@ bool performHPStoFPGAReset(bool ConsloeOutput, uint8_t reset_typ)
 			case 3: cout <<"#    Performing a reset on the LightWeight HPS-to-FPGA Bridge"<<endl; break;
 			case 4: cout <<"#    Performing a reset on the HPS-to-FPGA Bridge"<<endl; break;
 			case 5: cout <<"#    Performing a reset on the FPGA-to-HPS Bridge"<<endl; break;
+			case 6: cout <<"#    Performing a reset on all HPS<>FPGA Bridges"<<endl; break;
 			default:
 				cout <<"[ERROR]  Unkown Reset Type to perform!"<<endl; break;
 				return false;
 		}
 	}
 
-	// RESET =1 
+	// Select the Reset Manager register and bits of the reset
+	uint32_t reg =0;
+	uint32_t bits =0;
 
 	// Perform Cold or Warm FPGA Reset
-	if(reset_typ ==1) 		(void)  ((int) system( (const char*) "FPGA-writeBridge -mpu 0xFFD05020 -b 6 1 -b"));
-	else if(reset_typ ==2)  (void)  ((int) system( (const char*) "FPGA-writeBridge -mpu 0xFFD05020 -b 7 1 -b"));
+	if(reset_typ ==1) 		{ reg = REG_RSTMGR_MISCMODRST; bits = (1<<6); }
+	else if(reset_typ ==2)	{ reg = REG_RSTMGR_MISCMODRST; bits = (1<<7); }
 	// Perform a Bridge Reset
-	else if(reset_typ==3)	(void) ((int) system((const char*) "FPGA-writeBridge -mpu 0xFFD0501C -b 1 1 -b"));
-	else if(reset_typ==4)	(void) ((int) system((const char*) "FPGA-writeBridge -mpu 0xFFD0501C -b 0 1 -b"));
-	else if(reset_typ==5)	(void)  ((int) system((const char*) "FPGA-writeBridge -mpu 0xFFD0501C -b 2 1 -b"));
+	else if(reset_typ==3)	{ reg = REG_RSTMGR_BRGMODRST;  bits = (1<<1); }
+	else if(reset_typ==4)	{ reg = REG_RSTMGR_BRGMODRST;  bits = (1<<0); }
+	else if(reset_typ==5)	{ reg = REG_RSTMGR_BRGMODRST;  bits = (1<<2); }
+	else if(reset_typ==6)	{ reg = REG_RSTMGR_BRGMODRST;  bits = REG_RSTMGR_BRGMODRST_ALL; }
+	else return false;
+
+	// RESET =1 
+	if (rsMemSetBits(reg, bits) != RSMEM_SUCCESS)
+	{
+		if(ConsloeOutput)
+			cout << "[ERROR] Failed to access the Reset Manager"<<endl;
+		return false;
+	}
 
 	// Wait 50ms
 	// C++11: Put this task to sleep 
@@ -89,14 +191,7 @@ bool performHPStoFPGAReset(bool ConsloeOutput, uint8_t reset_typ)
 		std::chrono::milliseconds(50));
 
 	// RESET =0
-
-	// Perform Cold or Warm FPGA Reset
-	if(reset_typ ==1) 	   (void)  ((int) system((const char*) "FPGA-writeBridge -mpu 0xFFD05020 -b 6 0 -b"));
-	else if(reset_typ ==2) (void)  ((int) system((const char*) "FPGA-writeBridge -mpu 0xFFD05020 -b 7 0 -b"));
-	// Perform a Bridge Reset
-	else if(reset_typ==3)	(void)  ((int) system((const char*) "FPGA-writeBridge -mpu 0xFFD0501C -b 1 0 -b"));
-	else if(reset_typ==4)	(void)  ((int) system((const char*) "FPGA-writeBridge -mpu 0xFFD0501C -b 0 0 -b"));
-	else if(reset_typ==5)	(void)  ((int) system( (const char*) "FPGA-writeBridge -mpu 0xFFD0501C -b 2 0 -b"));
+	rsMemClearBits(reg, bits);
 
 	if(ConsloeOutput)
 		cout << "[SUCCESS] Reset performed"<<endl;
@@ -106,35 +201,444 @@ bool performHPStoFPGAReset(bool ConsloeOutput, uint8_t reset_typ)
 	return true;
 }
 
-bool writeFPGAconfig(const char* configFileAdress, bool withOutput)
+/*
+*   @brief               FPGA Manager istream callback: read the next chunk of the
+*						 configuration data (raw or decompressed)
+*	@param	buf			 buffer to fill
+*	@param	buf_len		 size of the buffer
+*	@param	user_data	 configSource_t of the file
+*   @return              number of bytes, 0 at the end of the data or -1 on error
+*/
+static int32_t configStreamRead(void* buf, size_t buf_len, void* user_data)
 {
-	/////////ceck vailed FPGA status  /////////
+	return (int32_t) configSourceRead((configSource_t*) user_data, buf, buf_len);
+}
 
-	/// check if the input file exist  
-	if (!is_file_exist(configFileAdress))
+/*
+*   @brief               FPGA Manager AXI writer: move the data with the DMA Controller
+*	@param	buf			 data inside the DMA buffer
+*	@param	buf_len		 number of bytes (multiple of 4)
+*	@param	user_data	 fpgaDma_t of the DMA buffer
+*   @return              ALT_E_SUCCESS or error code
+*/
+static ALT_STATUS_CODE configDmaWrite(const void* buf, size_t buf_len, void* user_data)
+{
+	return fpgaDmaTransfer((fpgaDma_t*) user_data, buf, buf_len, FPGADMA_FPGAMGRDATA);
+}
+
+/*
+*   @brief               Load the configuration file into the physically contiguous
+*						 DMA buffer and write it with the DMA Controller
+*	@param	src			 opened configuration file
+*	@param	withOutput	 Print Status Output to Console
+*	@param	load_ns		 time to load the file into the buffer
+*   @return              ALT_E_SUCCESS or error code
+*/
+static ALT_STATUS_CODE configureWithDma(configSource_t* src, bool withOutput, uint64_t* load_ns)
+{
+	fpgaDma_t dma;
+	if (!fpgaDmaOpen(&dma))
 	{
 		if (withOutput)
-			cout << "[ ERROR ] The selected config file does not exsist!" << endl;
+			cout << "[ ERROR ] Failed to open the DMA buffer /dev/" << FPGADMA_DEFAULT_BUF \
+				 << " (u-dma-buf driver, select another with " << FPGADMA_ENV_BUF << ")" << endl;
+		return ALT_E_ERROR;
+	}
+
+	// The size of a compressed file is only known after the decompression:
+	// the buffer is filled and must not be full at the end of the data
+	ALT_STATUS_CODE status = ALT_E_ERROR;
+	uint8_t* data = dma.virt + FPGADMA_PROG_SIZE;
+	size_t space = dma.size - FPGADMA_PROG_SIZE;
+	*load_ns = rsTimeNowNs();
+	ssize_t size = configSourceRead(src, data, space);
+	uint8_t probe;
+	if (size < 0)
+	{
+		if (withOutput)
+			cout << "[ ERROR ] Failed to read the selected config file!" << endl;
+	}
+	else if (((size_t) size == space) && (configSourceRead(src, &probe, 1) != 0))
+	{
+		if (withOutput)
+			cout << "[ ERROR ] The DMA buffer is too small for the selected config file!" << endl;
+	}
+	else
+	{
+		*load_ns = rsTimeNowNs() - *load_ns;
+		alt_fpga_axi_writer_set(configDmaWrite, &dma);
+		status = alt_fpga_configure(data, size);
+		alt_fpga_axi_writer_set(NULL, NULL);
+	}
+
+	fpgaDmaClose(&dma);
+	return status;
+}
+
+/*
+*   @brief               Check the DMA program generation of a configuration file
+*						 with the simulated DMA backend (no FPGA access)
+*	@param	configFileAdress	rbf file
+*	@param	withOutput	 Print Status Output to Console
+*   @return              success
+*/
+bool simulateDmaConfig(const char* configFileAdress, bool withOutput)
+{
+	// Simulated physical address of the DMA buffer
+	const uint32_t simPhys = 0x30000000;
+
+	configSource_t src;
+	if (!configSourceOpen(&src, configFileAdress))
+	{
+		if (withOutput)
+			cout << "[ ERROR ] Failed to open the selected config file (format: " \
+				 << configFormatName(src.format) << ")!" << endl;
 		return false;
 	}
 
-	/// Load the FPGA configuration file
+	// Read (and decompress) the whole configuration data after the program space
+	vector<uint8_t> mem(FPGADMA_PROG_SIZE);
+	ssize_t res;
+	do
+	{
+		size_t used = mem.size();
+		mem.resize(used + CONFIG_INPUT_SIZE);
+		res = configSourceRead(&src, mem.data() + used, CONFIG_INPUT_SIZE);
+		mem.resize(used + ((res > 0) ? res : 0));
+	} while (res > 0);
+	configSourceClose(&src);
+	if (res < 0)
+	{
+		if (withOutput)
+			cout << "[ ERROR ] Failed to read the selected config file!" << endl;
+		return false;
+	}
+	size_t size = mem.size() - FPGADMA_PROG_SIZE;
+
+	// Like the FPGA Manager: the DMA moves all complete 32-bit words
+	vector<uint8_t> prog;
+	vector<uint32_t> written;
+	uint32_t length = size & ~0x3;
+	fpgaDmaBuildProgram(prog, simPhys + FPGADMA_PROG_SIZE, FPGADMA_FPGAMGRDATA, length);
+
+	bool ok = (prog.size() <= FPGADMA_PROG_SIZE) && \
+		fpgaDmaSimulate(prog, mem.data(), simPhys, mem.size(), FPGADMA_FPGAMGRDATA, written);
+	ok = ok && (written.size() == length/4) && \
+		(memcmp(written.data(), mem.data() + FPGADMA_PROG_SIZE, length) == 0);
+
 	if (withOutput)
-		cout << "[ INFO ] Start writing the new FPGA configuration" << endl;
+	{
+		cout << "[ INFO ] DMA program: " << prog.size() << " Bytes for " << length << " Bytes to 0x" \
+			 << hex << FPGADMA_FPGAMGRDATA << dec << endl;
+		if (ok)
+			cout << "[ SUCCESS ] The simulated DMA wrote all " << written.size() << " words in order" << endl;
+		else
+			cout << "[ ERROR ] The simulated DMA transfer does not match the config file!" << endl;
+	}
+	return ok;
+}
 
-	// Open rbf config and load them to an binary buffer into the Memory
-	FILE* f = fopen(configFileAdress, "rb");
-	fseek(f, 0, SEEK_END);
-	long fsize = ftell(f);
-	fseek(f, 0, SEEK_SET);
+/*
+*   @brief               Write the JSON or binary timing report of a configuration
+*	@param	report		 timing report
+*	@param	file		 output file ("-": stdout)
+*	@param	binary		 binary instead of JSON output
+*   @return              success
+*/
+bool writeConfigReport(const configReport_t& report, const std::string& file, bool binary)
+{
+	ofstream outFile;
+	if (file != "-")
+	{
+		outFile.open(file, ios::out | ios::trunc | ios::binary);
+		if (!outFile.is_open()) return false;
+	}
+	ostream& out = (file == "-") ? cout : outFile;
 
-	char* buf = new char[fsize + 1];
-	fread(buf, 1, fsize, f);
-	fclose(f);
+	// Steps relative to the start (0: step not reached)
+	uint64_t step[ALT_FPGA_TRACE_STEPS];
+	for (uint8_t i = 0; i < ALT_FPGA_TRACE_STEPS; i++)
+		step[i] = (report.fpga.step_ns[i] > 0) ? (report.fpga.step_ns[i] - report.start_ns) : 0;
 
-	// Start to write the FPGA Configuration
-	ALT_STATUS_CODE status = alt_fpga_configure(buf, fsize);
+	if (binary)
+	{
+		configReportRecord_t rec;
+		memcpy(rec.magic, CONFIG_REPORT_MAGIC, 4);
+		rec.version = CONFIG_REPORT_VERSION;
+		memcpy(rec.step_ns, step, sizeof(step));
+		rec.stream_ns = report.fpga.stream_ns;
+		rec.write_ns  = report.fpga.write_ns;
+		rec.load_ns   = report.load_ns;
+		rec.reset_ns  = report.reset_ns;
+		rec.total_ns  = report.end_ns - report.start_ns;
+		rec.bytes     = report.fpga.bytes;
+		rec.file_size = report.file_size;
+		rec.chunks    = report.fpga.chunks;
+		rec.status    = report.fpga.status;
+		rec.dma       = report.dma ? 1 : 0;
+		memcpy(rec.wait, report.fpga.wait, sizeof(rec.wait));
+		rec.format    = report.format;
+		rec.cache     = report.cache;
+		rec.skipped   = report.skipped ? 1 : 0;
+		out.write((const char*) &rec, sizeof(rec));
+	}
+	else
+	{
+		const char* names[ALT_FPGA_TRACE_STEPS] = {"start", "reset", "config", "data_start", \
+			"data_done", "conf_done", "dclk", "user_mode", "end"};
+		const char* waitNames[ALT_FPGA_WAITS] = {"state", "config", "dclk"};
+
+		out << "{" << endl;
+		out << "  \"mode\": \"" << (report.dma ? "dma" : "istream") << "\"," << endl;
+		out << "  \"status\": " << report.fpga.status << "," << endl;
+		out << "  \"skipped\": " << (report.skipped ? "true" : "false") << "," << endl;
+		out << "  \"format\": \"" << configFormatName(report.format) << "\"," << endl;
+		out << "  \"cache\": \"" << ((report.cache == CONFIG_CACHE_HIT) ? "hit" : \
+			((report.cache == CONFIG_CACHE_MISS) ? "miss" : "off")) << "\"," << endl;
+		out << "  \"file_size\": " << report.file_size << "," << endl;
+		out << "  \"bytes\": " << report.fpga.bytes << "," << endl;
+		out << "  \"chunks\": " << report.fpga.chunks << "," << endl;
+		out << "  \"steps_ns\": {";
+		for (uint8_t i = 0; i < ALT_FPGA_TRACE_STEPS; i++)
+			out << (i ? ", " : " ") << "\"" << names[i] << "\": " << step[i];
+		out << " }," << endl;
+		out << "  \"stream_ns\": " << report.fpga.stream_ns << "," << endl;
+		out << "  \"write_ns\": " << report.fpga.write_ns << "," << endl;
+		out << "  \"load_ns\": " << report.load_ns << "," << endl;
+		out << "  \"reset_ns\": " << report.reset_ns << "," << endl;
+		out << "  \"waits\": {" << endl;
+		for (uint8_t i = 0; i < ALT_FPGA_WAITS; i++)
+		{
+			const ALT_FPGA_WAIT_STATS_t& w = report.fpga.wait[i];
+			out << "    \"" << waitNames[i] << "\": { \"calls\": " << w.calls << ", \"timeouts\": " << w.timeouts \
+				<< ", \"iterations\": " << w.iterations << ", \"yields\": " << w.yields << ", \"sleeps\": " << w.sleeps \
+				<< ", \"elapsed_ns\": " << w.elapsed_ns << ", \"max_ns\": " << w.max_ns << " }" \
+				<< ((i + 1 < ALT_FPGA_WAITS) ? "," : "") << endl;
+		}
+		out << "  }," << endl;
+		out << "  \"total_ns\": " << (report.end_ns - report.start_ns) << endl;
+		out << "}" << endl;
+	}
+	out.flush();
+	return out.good();
+}
+
+/*
+*   @brief               Simulated FPGA Manager data port: write all words to a
+*						 register stand-in and hold the transfer rate of the port
+*	@param	buf			 configuration data
+*	@param	len			 number of bytes
+*	@param	rate		 MB/s of the port (0: unlimited)
+*   @return              number of bytes written
+*/
+// Register stand-in of the simulated data port
+static volatile uint32_t simPortRegister;
+
+static size_t simPortWrite(const void* buf, size_t len, uint32_t rate)
+{
+	uint64_t until = rsTimeNowNs() + ((rate > 0) ? ((uint64_t) len * 1000) / rate : 0);
+
+	const uint32_t* words = (const uint32_t*) buf;
+	for (size_t i = 0; i < len / 4; i++)
+		simPortRegister = words[i];
 
+	// Wait until the port accepted the data. The core is given away, like a
+	// second core of the HPS can run the reader while the first one is stalled
+	rsTimeWaitUntilNs(until);
+	return len;
+}
+
+/*
+*   @brief               Benchmark of the configuration data paths with a simulated
+*						 data port (no FPGA access): full buffer, synchronous istream
+*						 and the reader thread pipeline
+*	@param	configFileAdress	rbf, rbf.gz, rbf.zst or rbf.lz4 file
+*	@param	slotSize	 slot size of the pipeline
+*	@param	rate		 MB/s of the simulated data port (0: unlimited)
+*   @return              success
+*/
+bool benchmarkConfigPaths(const char* configFileAdress, size_t slotSize, uint32_t rate)
+{
+	const char* names[3] = {"full buffer", "istream", "pipeline"};
+	uint64_t bytes[3] = {0, 0, 0};
+	uint64_t time[3] = {0, 0, 0};
+	uint64_t readerWaitNs = 0, consumerWaitNs = 0;
+
+	for (uint8_t mode = 0; mode < 3; mode++)
+	{
+		configSource_t src;
+		if (!configSourceOpen(&src, configFileAdress))
+		{
+			cout << "[ ERROR ] Failed to open the selected config file (format: " \
+				 << configFormatName(src.format) << ")!" << endl;
+			return false;
+		}
+
+		ssize_t res = 0;
+		uint64_t start = rsTimeNowNs();
+		if (mode == 0)
+		{
+			// Read the whole file, then write it
+			vector<uint8_t> data;
+			do
+			{
+				size_t used = data.size();
+				data.resize(used + CONFIG_INPUT_SIZE);
+				res = configSourceRead(&src, data.data() + used, CONFIG_INPUT_SIZE);
+				data.resize(used + ((res > 0) ? res : 0));
+			} while (res > 0);
+			if (res == 0)
+				bytes[mode] += simPortWrite(data.data(), data.size(), rate);
+		}
+		else if (mode == 1)
+		{
+			// Read a chunk, write it, read the next chunk
+			static uint32_t chunk[PIPESIM_ISTREAM_CHUNK / 4];
+			while ((res = configSourceRead(&src, chunk, sizeof(chunk))) > 0)
+				bytes[mode] += simPortWrite(chunk, res, rate);
+		}
+		else
+		{
+			// Reader thread fills the slots while the slots are written
+			configPipe_t pipe;
+			if (!configPipeStart(&pipe, &src, slotSize))
+			{
+				configSourceClose(&src);
+				cout << "[ ERROR ] Failed to start the reader thread!" << endl;
+				return false;
+			}
+			const void* slot;
+			while ((res = configPipeNext(&slot, &pipe)) > 0)
+				bytes[mode] += simPortWrite(slot, res, rate);
+			configPipeStop(&pipe);
+			readerWaitNs = pipe.readerWaitNs;
+			consumerWaitNs = pipe.consumerWaitNs;
+		}
+		time[mode] = rsTimeNowNs() - start;
+		configSourceClose(&src);
+
+		if (res < 0)
+		{
+			cout << "[ ERROR ] Failed to read the selected config file!" << endl;
+			return false;
+		}
+	}
+
+	cout << "[ INFO ] Data port: " << (rate ? to_string(rate) + " MB/s" : string("unlimited")) \
+		 << ", pipeline slots: " << CONFIG_PIPE_SLOTS << " x " << slotSize / 1024 << " KiB" << endl;
+	for (uint8_t mode = 0; mode < 3; mode++)
+	{
+		cout << "  " << names[mode] << ": " << bytes[mode] << " Bytes in " << time[mode] / 1000 << " us, " \
+			 << (time[mode] ? (bytes[mode] * 1000) / time[mode] : 0) << " MB/s" << endl;
+	}
+	cout << "  pipeline stalls: reader " << readerWaitNs / 1000 << " us, port " << consumerWaitNs / 1000 << " us" << endl;
+	return (bytes[0] == bytes[1]) && (bytes[1] == bytes[2]);
+}
+
+/*
+*   @brief               Write the FPGA configuration from the bitstream cache
+*						 (on a miss the file is loaded into the cache first)
+*	@param	configFileAdress	rbf, rbf.gz, rbf.zst or rbf.lz4 file
+*	@param	withOutput	 Print Status Output to Console
+*	@param	status		 ALT_STATUS_CODE of the configuration
+*	@param	state		 content hash and size of the written configuration
+*	@param	report		 timing report or nullptr
+*   @return              true if the configuration was written from the cache;
+*						 false if the cache can not be used (nothing was written)
+*/
+static bool configureFromCache(const char* configFileAdress, bool withOutput, ALT_STATUS_CODE* status, \
+	configState_t* state, configReport_t* report)
+{
+	configCache_t cache;
+	if (!configCacheOpen(&cache, true))
+	{
+		if (withOutput)
+			cout << "[ WARNING ] Failed to open the bitstream cache " << CONFIG_CACHE_SHM << endl;
+		return false;
+	}
+
+	uint8_t slot;
+	configCacheResult_t res = configCacheGet(&cache, configFileAdress, &slot);
+	if ((res != CONFIG_CACHE_HIT) && (res != CONFIG_CACHE_MISS))
+	{
+		if (withOutput)
+			cout << "[ WARNING ] The config file can not be cached (" \
+				 << ((res == CONFIG_CACHE_TOO_LARGE) ? "too large" : "read error") << ")" << endl;
+		configCacheClose(&cache);
+		return false;
+	}
+
+	const configCacheSlot_t& entry = cache.header->slot[slot];
+	const uint8_t* data = configCacheData(&cache, slot);
+	if (withOutput)
+		cout << "[ INFO ] Bitstream cache " << ((res == CONFIG_CACHE_HIT) ? "hit" : "miss, loaded in ") \
+			 << ((res == CONFIG_CACHE_HIT) ? string("") : to_string(entry.loadNs / 1000) + " us") << endl;
+
+	// Pure data push: the image is resident, the page tables are populated before
+	bool locked = (mlock(data, entry.size) == 0);
+	if (report != nullptr)
+	{
+		report->file_size = entry.fileSize;
+		report->cache = res;
+		report->load_ns = (res == CONFIG_CACHE_MISS) ? entry.loadNs : 0;
+		alt_fpga_trace_set(&report->fpga);
+	}
+	*status = alt_fpga_configure(data, entry.size);
+	if (report != nullptr)
+		alt_fpga_trace_set(NULL);
+	state->hash = entry.hash;
+	state->bytes = entry.size;
+	if (locked)
+		munlock(data, entry.size);
+
+	configCacheClose(&cache);
+	return true;
+}
+
+/*
+*   @brief               Print the statistics and images of the bitstream cache
+*   @return              success
+*/
+bool printCacheStats(void)
+{
+	configCache_t cache;
+	if (!configCacheOpen(&cache, false))
+	{
+		cout << "[ INFO ] The bitstream cache " << CONFIG_CACHE_SHM << " is empty" << endl;
+		return false;
+	}
+
+	const configCacheHeader_t* header = cache.header;
+	uint64_t lookups = header->hits + header->misses;
+	cout << "Bitstream cache " << CONFIG_CACHE_SHM << ": " << header->slots << " slots of " \
+		 << header->slotSize / (1024*1024) << " MiB" << endl;
+	cout << "  hits: " << header->hits << ", misses: " << header->misses << ", hit rate: " \
+		 << (lookups ? (header->hits * 100) / lookups : 0) << " %" << endl;
+	cout << "  load time: " << header->loadNs / 1000 << " us total, " \
+		 << (header->misses ? header->loadNs / header->misses / 1000 : 0) << " us per miss" << endl;
+	for (uint8_t i = 0; i < CONFIG_CACHE_SLOTS; i++)
+	{
+		const configCacheSlot_t& slot = header->slot[i];
+		if (!slot.valid) continue;
+		cout << "  [" << (int) i << "] " << slot.name << ": " << slot.size << " Bytes, hits: " << slot.hits \
+			 << ", loaded in " << slot.loadNs / 1000 << " us, hash: " << hex << slot.hash << dec << endl;
+	}
+
+	configCacheClose(&cache);
+	return true;
+}
+
+/*
+*   @brief               Report the result of a configuration and reset the bridges
+*						 and the FPGA after a successful configuration
+*	@param	status		 ALT_STATUS_CODE of the configuration
+*	@param	withOutput	 Print Status Output to Console
+*	@param	state		 record of the configuration (stored after a success)
+*	@param	report		 timing report or nullptr
+*   @return              success
+*/
+static bool finishFPGAconfig(ALT_STATUS_CODE status, bool withOutput, configState_t* state, configReport_t* report)
+{
 	if (status != ALT_E_SUCCESS)
 	{
 		if (withOutput)
@@ -146,27 +650,285 @@ bool writeFPGAconfig(const char* configFileAdress, bool withOutput)
 		if (withOutput)
 			cout << "[ SUCCESS ] The FPGA runs now with the new configuration" << endl;
 
+		// Remember the configuration to skip writing it again
+		state->time = time(nullptr);
+		if (!state->path.empty() && !configStateWrite(state) && withOutput)
+			cout << "[ WARNING ] Failed to write " << CONFIG_STATE_FILE << endl;
+
 		// Reset all Bridges
 		if (withOutput)
 			cout << "[ INFO] Performing a reset on all Bridge Interfaces" <<endl;
 		
-		for (uint8_t i=3; i<6;i++)
-		{
-			performHPStoFPGAReset(withOutput,i);
-		}
+		// All bridges are hold in reset together with a single read-modify-write
+		uint64_t reset_start = rsTimeNowNs();
+		performHPStoFPGAReset(withOutput,6);
 
 		// Perform COLD FPGA Reset
 		performHPStoFPGAReset(withOutput,2);
+
+		if (report != nullptr)
+		{
+			report->end_ns = rsTimeNowNs();
+			report->reset_ns = report->end_ns - reset_start;
+		}
 		return true;
 	}
 
 	return false;
 }
 
+/*
+*   @brief               Check if the FPGA already runs the configuration of a file:
+*						 the FPGA is in user mode and the record of the last
+*						 configuration matches the file (identical file or content hash)
+*	@param	file		 identity of the configuration file
+*	@param	withOutput	 Print Status Output to Console
+*   @return              true if the configuration can be skipped
+*/
+static bool isConfigLoaded(const configState_t& file, const char* configFileAdress, bool withOutput)
+{
+	configState_t last;
+	if (!configStateRead(&last))
+		return false;
+	if (alt_fpga_state_get() != ALT_FPGA_STATE_USER_MODE)
+		return false;
+
+	// The same unchanged file
+	if ((last.path == file.path) && (last.fileSize == file.fileSize) && (last.fileMtime == file.fileMtime) && \
+		(last.fileIno == file.fileIno))
+		return true;
+
+	// Another file (or a changed one): compare the content
+	uint64_t hash, bytes;
+	if (!configStateHashFile(configFileAdress, &hash, &bytes))
+		return false;
+	if (withOutput && (hash == last.hash) && (bytes == last.bytes))
+		cout << "[ INFO ] The config file has the same content as " << last.path << endl;
+	return (hash == last.hash) && (bytes == last.bytes);
+}
+
+bool writeFPGAconfig(const char* configFileAdress, bool withOutput, bool useDma, size_t slotSize, bool useCache, \
+	bool force, configReport_t* report)
+{
+	// Timestamp all steps of the configuration
+	if (report != nullptr)
+	{
+		memset(report, 0, sizeof(configReport_t));
+		report->start_ns = rsTimeNowNs();
+		report->dma = useDma;
+		report->cache = -1;
+		report->skipped = false;
+	}
+
+	/////////ceck vailed FPGA status  /////////
+
+	/// check if the input file exist  
+	if (!is_file_exist(configFileAdress))
+	{
+		if (withOutput)
+			cout << "[ ERROR ] The selected config file does not exsist!" << endl;
+		return false;
+	}
+
+	/// Skip the configuration if the FPGA already runs it
+	configState_t state;
+	if (!configStateIdentify(&state, configFileAdress))
+		state.path.clear();
+	if (!force && !state.path.empty() && isConfigLoaded(state, configFileAdress, withOutput))
+	{
+		if (withOutput)
+			cout << "[ SUCCESS ] The FPGA already runs this configuration (use -force to write it again)" << endl;
+		if (report != nullptr)
+		{
+			report->skipped = true;
+			report->file_size = state.fileSize;
+			report->end_ns = rsTimeNowNs();
+		}
+		return true;
+	}
+	// From now on the FPGA does not run the recorded configuration anymore
+	configStateClear();
+
+	/// Load the FPGA configuration file
+	if (withOutput)
+		cout << "[ INFO ] Start writing the new FPGA configuration" << endl;
+
+	// The DMA Controller reads only its own buffer, the cache is used for the PIO path
+	ALT_STATUS_CODE status;
+	if (useCache && !useDma && configureFromCache(configFileAdress, withOutput, &status, &state, report))
+	{
+		if (report != nullptr)
+			report->end_ns = rsTimeNowNs();
+		return finishFPGAconfig(status, withOutput, &state, report);
+	}
+
+	// Open rbf config and stream it chunk by chunk to the FPGA Manager
+	// (compressed files are decompressed on the fly)
+	configSource_t stream;
+	if (!configSourceOpen(&stream, configFileAdress))
+	{
+		if (withOutput)
+		{
+			if (stream.format == CONFIG_FORMAT_RAW)
+				cout << "[ ERROR ] Failed to open the selected config file!" << endl;
+			else
+				cout << "[ ERROR ] The " << configFormatName(stream.format) \
+					 << " compressed config file is not supported by this build!" << endl;
+		}
+		return false;
+	}
+	if (withOutput && (stream.format != CONFIG_FORMAT_RAW))
+		cout << "[ INFO ] Decompressing the " << configFormatName(stream.format) << " config file" << endl;
+
+	// Start to write the FPGA Configuration
+	uint64_t load_ns = 0;
+	if (report != nullptr)
+		alt_fpga_trace_set(&report->fpga);
+	if (useDma)
+		status = configureWithDma(&stream, withOutput, &load_ns);
+	else
+	{
+		// Read the file with a reader thread while the FPGA Manager writes the data,
+		// without the thread (slot size 0 or no resources) chunk by chunk
+		configPipe_t pipe;
+		if ((slotSize > 0) && configPipeStart(&pipe, &stream, slotSize))
+		{
+			status = alt_fpga_istream_map_configure(configPipeNext, &pipe);
+			configPipeStop(&pipe);
+		}
+		else
+			status = alt_fpga_istream_configure(configStreamRead, &stream);
+	}
+	state.hash = configSourceHash(&stream);
+	state.bytes = stream.output;
+	configSourceClose(&stream);
+
+	if (report != nullptr)
+	{
+		alt_fpga_trace_set(NULL);
+		report->file_size = stream.size;
+		report->format = stream.format;
+		report->load_ns = load_ns;
+		report->end_ns = rsTimeNowNs();
+	}
+
+	return finishFPGAconfig(status, withOutput, &state, report);
+}
+
+/*
+*   @brief               Let the rstoolsd daemon write a FPGA configuration (-f or -r)
+*						 The daemon runs FPGA-writeConfig itself, this process needs
+*						 no access to the memory driver
+*   @param	path		 configuration file
+*   @param	argc		 number of arguments
+*   @param	argv		 arguments (-b, -dma, -cache and -force are passed on)
+*   @return              success
+*/
+bool writeFPGAconfigRemote(const char* path, int argc, const char* argv[])
+{
+	bool withOutput = true;
+	uint32_t flags = 0;
+	for (int i = 2; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "-b") withOutput = false;
+		if (arg == "-dma") flags |= RSPROTO_CONFIG_DMA;
+		if (arg == "-cache") flags |= RSPROTO_CONFIG_CACHE;
+		if (arg == "-force") flags |= RSPROTO_CONFIG_FORCE;
+		if (((arg == "-chunk") || (arg == "-trace") || (arg == "-tracebin")) && withOutput)
+			cout << "[ WARNING ] " << arg << " is not available over rstoolsd and ignored" << endl;
+	}
+
+	// The daemon has another working directory
+	char* fullPath = realpath(path, nullptr);
+	if (fullPath == nullptr)
+	{
+		if (withOutput)
+			cout << "[ ERROR ] The selected config file does not exsist!" << endl;
+		else
+			cout << 0;
+		return false;
+	}
+
+	int res = rsClientOpen(nullptr);
+	if (res == RSMEM_SUCCESS)
+		res = rsClientConfig(fullPath, flags);
+	rsClientClose();
+	free(fullPath);
+
+	if (withOutput)
+	{
+		if (res == RSMEM_SUCCESS)
+			cout << "[ SUCCESS ] The FPGA runs now with the new configuration (rstoolsd)" << endl;
+		else if (res == RSPROTO_ERR_CONFIG)
+			cout << "[ ERROR ] Writing the FPGA configuration over rstoolsd failed" << endl;
+		else
+			cout << "[ ERROR ] Failed to access the rstoolsd daemon at " << rsClientSocketPath() << "!" << endl;
+	}
+	else
+		cout << ((res == RSMEM_SUCCESS) ? 1 : 0);
+	return res == RSMEM_SUCCESS;
+}
 
 
 int main(int argc, const char* argv[])
 {
+	// Check the DMA program of a config file without accessing the FPGA
+	if ((argc > 2) && (std::string(argv[1]) == "-dmasim"))
+	{
+		bool withOutput = !((argc > 3) && (std::string(argv[3]) == "-b"));
+		bool res = simulateDmaConfig(argv[2], withOutput);
+		if (!withOutput) cout << (res ? 1 : 0);
+		return 0;
+	}
+
+	// Benchmark of the configuration data paths without accessing the FPGA
+	if ((argc > 2) && (std::string(argv[1]) == "-pipesim"))
+	{
+		size_t slotSize = CONFIG_PIPE_SLOT_SIZE;
+		uint32_t rate = PIPESIM_DEFAULT_RATE;
+		for (int i = 3; i + 1 < argc; i++)
+		{
+			std::string arg = argv[i];
+			if (arg == "-chunk") slotSize = strtoul(argv[++i], nullptr, 10) * 1024;
+			else if (arg == "-rate") rate = strtoul(argv[++i], nullptr, 10);
+		}
+		benchmarkConfigPaths(argv[2], slotSize, rate);
+		return 0;
+	}
+
+	// Statistics of the bitstream cache or remove all cached images
+	if ((argc > 1) && (std::string(argv[1]) == "-cachestat"))
+	{
+		printCacheStats();
+		return 0;
+	}
+	if ((argc > 1) && (std::string(argv[1]) == "-cacheflush"))
+	{
+		bool withOutput = !((argc > 2) && (std::string(argv[2]) == "-b"));
+		bool res = configCacheFlush();
+		if (withOutput)
+			cout << (res ? "[ SUCCESS ] The bitstream cache was removed" : "[ ERROR ] Failed to remove the bitstream cache") << endl;
+		else
+			cout << (res ? 1 : 0);
+		return 0;
+	}
+
+	// With rstoolsd the daemon writes the configuration
+	const char* socket = getenv(RSPROTO_ENV_SOCKET);
+	if ((socket != nullptr) && (socket[0] != '\0'))
+	{
+		if ((argc > 2) && (std::string(argv[1]) == "-f"))
+		{
+			writeFPGAconfigRemote(argv[2], argc, argv);
+			return 0;
+		}
+		if ((argc > 1) && (std::string(argv[1]) == "-r"))
+		{
+			writeFPGAconfigRemote("/usr/rsyocto/running_bootloader_fpgaconfig.rbf", argc, argv);
+			return 0;
+		}
+	}
 
 	///////// init the Virtual Memory for I/O access /////////
 	__VIRTUALMEM_SPACE_INIT();
@@ -182,26 +944,94 @@ int main(int argc, const char* argv[])
 	// change to a new selected FPGA configuration
 	if ((argc > 2) && (std::string(argv[1]) == "-f"))
 	{
-		bool withOutput = !((argc > 3) && (std::string(argv[3]) == "-b"));
-		bool res = writeFPGAconfig(argv[2], withOutput);
+		bool withOutput = true;
+		bool useDma = false;
+		std::string traceFile;
+		bool traceBinary = false;
+		size_t slotSize = CONFIG_PIPE_SLOT_SIZE;
+		bool useCache = false;
+		bool force = false;
+		for (int i = 3; i < argc; i++)
+		{
+			std::string arg = argv[i];
+			if (arg == "-b") withOutput = false;
+			if (arg == "-dma") useDma = true;
+			if (arg == "-cache") useCache = true;
+			if (arg == "-force") force = true;
+			if ((arg == "-chunk") && (i+1 < argc))
+				slotSize = strtoul(argv[++i], nullptr, 10) * 1024;
+			if (((arg == "-trace") || (arg == "-tracebin")) && (i+1 < argc))
+			{
+				traceFile = argv[++i];
+				traceBinary = (arg == "-tracebin");
+			}
+		}
+
+		configReport_t report;
+		bool res = false;
+		if ((slotSize != 0) && ((slotSize < CONFIG_PIPE_SLOT_MIN) || (slotSize > CONFIG_PIPE_SLOT_MAX)))
+		{
+			if (withOutput)
+				cout << "[ ERROR ] The chunk size must be 0 or between " << CONFIG_PIPE_SLOT_MIN / 1024 \
+					 << " and " << CONFIG_PIPE_SLOT_MAX / 1024 << " KiB!" << endl;
+			report.end_ns = 0;
+		}
+		else
+			res = writeFPGAconfig(argv[2], withOutput, useDma, slotSize, useCache, force, \
+				traceFile.empty() ? nullptr : &report);
+
+		if ((!traceFile.empty()) && (report.end_ns > 0))
+		{
+			if (!writeConfigReport(report, traceFile, traceBinary) && withOutput)
+				cout << "[ ERROR ] Failed to write the timing report!" << endl;
+		}
 
 		if (!withOutput) cout << res ? 1 : 0;
 	}
 	// restore the the boot up configuration 
 	else if ((argc > 1) && (std::string(argv[1]) == "-r"))
 	{
-		bool withOutput = !((argc > 2) && (std::string(argv[2]) == "-b"));
-		bool res = writeFPGAconfig("/usr/rsyocto/running_bootloader_fpgaconfig.rbf", withOutput);
+		bool withOutput = true;
+		bool useCache = false;
+		bool force = false;
+		for (int i = 2; i < argc; i++)
+		{
+			if (std::string(argv[i]) == "-b") withOutput = false;
+			if (std::string(argv[i]) == "-cache") useCache = true;
+			if (std::string(argv[i]) == "-force") force = true;
+		}
+		bool res = writeFPGAconfig("/usr/rsyocto/running_bootloader_fpgaconfig.rbf", withOutput, false, \
+			CONFIG_PIPE_SLOT_SIZE, useCache, force, nullptr);
 		if (!withOutput) cout << res ? 1 : 0;
 	}
 	else 
 	{
 		cout << "	Command to change the FPGA fabric configuration" << endl;
-		cout << "	FPGA-writeConfig -f [config rbf file path] {-b [optional]}" << endl;
-		cout << "		change the FPGA config with a selected .rbf file" << endl;
-		cout << "	FPGA-writeConfig -r {-b [optional]}" << endl;
+		cout << "	FPGA-writeConfig -f [config rbf file path] {-dma [optional]} {-b [optional]}" << endl;
+		cout << "		change the FPGA config with a selected .rbf file (or compressed .rbf.gz, .rbf.zst, .rbf.lz4 file)" << endl;
+		cout << "		suffix: -dma -> write the config with the HPS DMA Controller (channel " << FPGADMA_DEFAULT_CHANNEL << ")" << endl;
+		cout << "						from the u-dma-buf buffer /dev/" << FPGADMA_DEFAULT_BUF << " (or " << FPGADMA_ENV_BUF << ")" << endl;
+		cout << "		suffix: -chunk [KiB] -> buffer size of the reader thread (default: " << CONFIG_PIPE_SLOT_SIZE / 1024 \
+			 << " KiB, 0: no thread)" << endl;
+		cout << "		suffix: -cache -> keep the config in the shared memory bitstream cache and" << endl;
+		cout << "						write it from there without file I/O next time" << endl;
+		cout << "		suffix: -force -> write the config also if the FPGA already runs it" << endl;
+		cout << "						(recorded in " << CONFIG_STATE_FILE << ")" << endl;
+		cout << "		suffix: -trace [file|-] -> write a JSON timing report of all configuration steps" << endl;
+		cout << "		suffix: -tracebin [file] -> write the timing report as binary record" << endl;
+		cout << "	FPGA-writeConfig -dmasim [config rbf file path] {-b [optional]}" << endl;
+		cout << "		check the DMA program of a .rbf file with the simulated DMA (no FPGA access)" << endl;
+		cout << "	FPGA-writeConfig -pipesim [config rbf file path] {-chunk [KiB]} {-rate [MB/s]}" << endl;
+		cout << "		benchmark the full buffer, istream and reader thread data paths" << endl;
+		cout << "		with a simulated data port (default: " << PIPESIM_DEFAULT_RATE << " MB/s, no FPGA access)" << endl;
+		cout << "	FPGA-writeConfig -r {-cache [optional]} {-force [optional]} {-b [optional]}" << endl;
 		cout << "		restore to the boot up FPGA configuration" << endl;
 		cout << "		this conf File is located: /usr/rsyocto/running_bootloader_fpgaconfig.rbf" << endl;
+		cout << "	With $" << RSPROTO_ENV_SOCKET << " set -f and -r are written by the rstoolsd daemon" << endl;
+		cout << "	FPGA-writeConfig -cachestat" << endl;
+		cout << "		print the hit/miss and load time statistics of the bitstream cache" << endl;
+		cout << "	FPGA-writeConfig -cacheflush {-b [optional]}" << endl;
+		cout << "		remove all configurations from the bitstream cache" << endl;
 		cout << "		suffix: -b -> only decimal result output"<<endl;
 		cout << "						Error:  0" << endl;
 		cout << "						Succses:1" << endl;
@@ -216,6 +1046,7 @@ int main(int argc, const char* argv[])
 
 	// free the dynamic access memory
 	__VIRTUALMEM_SPACE_DEINIT();
+	rsMemClose();
 
 	return 0;
 }
@@ -0,0 +1,213 @@
+/**
+ *
+ * @file    rstools_block.cpp
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools block transfers between mapped device memory and the application memory
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Block writes to device memory
+ * 		1.20 (10-16-2026)
+ * 		Vectorized search of differing words
+ * 		1.30 (10-16-2026)
+ * 		Shared write of a buffer to a file descriptor
+ * 		1.40 (10-16-2026)
+ * 		64-bit and 128-bit block writes to device memory
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "rstools_block.h"
+
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>					// POSIX: write
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RSBLOCK_NEON 1
+#endif
+
+using namespace std;
+
+// 16 Byte vector of the compiler (NEON q-register on ARM, SSE2 register on x86)
+typedef uint32_t rsVec128_t __attribute__((vector_size(16)));
+
+void rsBlockCopyFromDev(void* dst, const volatile uint32_t* src, size_t length)
+{
+	uint32_t* out = (uint32_t*) dst;
+	size_t words = length / 4;
+	size_t i = 0;
+
+	// Four independent loads per loop to keep the bus busy
+	for (; i + 4 <= words; i += 4)
+	{
+		uint32_t w0 = src[i];
+		uint32_t w1 = src[i+1];
+		uint32_t w2 = src[i+2];
+		uint32_t w3 = src[i+3];
+		out[i]   = w0;
+		out[i+1] = w1;
+		out[i+2] = w2;
+		out[i+3] = w3;
+	}
+	for (; i < words; i++)
+	{
+		out[i] = src[i];
+	}
+}
+
+void rsBlockCopyToDev(volatile uint32_t* dst, const void* src, size_t length)
+{
+	const uint32_t* in = (const uint32_t*) src;
+	size_t words = length / 4;
+	size_t i = 0;
+
+	// Four stores per loop, the writes are posted back-to-back
+	for (; i + 4 <= words; i += 4)
+	{
+		uint32_t w0 = in[i];
+		uint32_t w1 = in[i+1];
+		uint32_t w2 = in[i+2];
+		uint32_t w3 = in[i+3];
+		dst[i]   = w0;
+		dst[i+1] = w1;
+		dst[i+2] = w2;
+		dst[i+3] = w3;
+	}
+	for (; i < words; i++)
+	{
+		dst[i] = in[i];
+	}
+}
+
+bool rsBlockWidthValid(uint8_t width)
+{
+	return (width == RSBLOCK_WIDTH_32) || (width == RSBLOCK_WIDTH_64) || (width == RSBLOCK_WIDTH_128);
+}
+
+#ifdef RSBLOCK_NEON
+
+// One vst1 per store, the NEON unit issues it as one 64-bit or 128-bit access
+static void copyToDev64(volatile void* dst, const void* src, size_t length)
+{
+	uint32_t* out = (uint32_t*) dst;
+	const uint32_t* in = (const uint32_t*) src;
+	for (size_t i = 0; i < length / 4; i += 2)
+		vst1_u32(out + i, vld1_u32(in + i));
+}
+
+static void copyToDev128(volatile void* dst, const void* src, size_t length)
+{
+	uint32_t* out = (uint32_t*) dst;
+	const uint32_t* in = (const uint32_t*) src;
+	for (size_t i = 0; i < length / 4; i += 4)
+		vst1q_u32(out + i, vld1q_u32(in + i));
+}
+
+#else
+
+// The source may be only 32-bit aligned, the words are loaded with memcpy
+static void copyToDev64(volatile void* dst, const void* src, size_t length)
+{
+	volatile uint64_t* out = (volatile uint64_t*) dst;
+	const uint8_t* in = (const uint8_t*) src;
+	for (size_t i = 0; i < length / 8; i++)
+	{
+		uint64_t w;
+		memcpy(&w, in + i*8, sizeof(w));
+		out[i] = w;
+	}
+}
+
+static void copyToDev128(volatile void* dst, const void* src, size_t length)
+{
+	volatile rsVec128_t* out = (volatile rsVec128_t*) dst;
+	const uint8_t* in = (const uint8_t*) src;
+	for (size_t i = 0; i < length / 16; i++)
+	{
+		rsVec128_t v;
+		memcpy(&v, in + i*16, sizeof(v));
+		out[i] = v;
+	}
+}
+
+#endif
+
+void rsBlockCopyToDevWide(volatile void* dst, const void* src, size_t length, uint8_t width)
+{
+	if (width == RSBLOCK_WIDTH_64)
+		copyToDev64(dst, src, length);
+	else if (width == RSBLOCK_WIDTH_128)
+		copyToDev128(dst, src, length);
+	else
+		rsBlockCopyToDev((volatile uint32_t*) dst, src, length);
+}
+
+size_t rsBlockFindDiff(const uint32_t* a, const uint32_t* b, size_t words, size_t start)
+{
+	size_t i = start;
+
+	// Compare four words at once, the buffers may not be 16 Byte aligned
+	for (; i + 4 <= words; i += 4)
+	{
+		rsVec128_t va, vb;
+		memcpy(&va, a + i, sizeof(va));
+		memcpy(&vb, b + i, sizeof(vb));
+		rsVec128_t diff = va ^ vb;
+		if ((diff[0] | diff[1] | diff[2] | diff[3]) != 0) break;
+	}
+	for (; i < words; i++)
+	{
+		if (a[i] != b[i]) break;
+	}
+	return i;
+}
+
+size_t rsBlockFindSame(const uint32_t* a, const uint32_t* b, size_t words, size_t start)
+{
+	size_t i = start;
+	while ((i < words) && (a[i] != b[i])) i++;
+	return i;
+}
+
+bool rsBlockWriteFd(int fd, const void* buf, size_t length)
+{
+	const uint8_t* ptr = (const uint8_t*) buf;
+	while (length > 0)
+	{
+		ssize_t res = write(fd, ptr, length);
+		if (res < 0)
+		{
+			if (errno == EINTR) continue;
+			return false;
+		}
+		ptr    += res;
+		length -= res;
+	}
+	return true;
+}
+
+bool rsBlockDevToFd(int fd, const volatile uint32_t* src, size_t length)
+{
+	vector<uint32_t> chunk(RSBLOCK_CHUNK_SIZE / 4);
+
+	while (length > 0)
+	{
+		size_t len = (length > RSBLOCK_CHUNK_SIZE) ? RSBLOCK_CHUNK_SIZE : length;
+		rsBlockCopyFromDev(chunk.data(), src, len);
+		if (!rsBlockWriteFd(fd, chunk.data(), len))
+			return false;
+
+		src    += len / 4;
+		length -= len;
+	}
+	return true;
+}
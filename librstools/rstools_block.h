@@ -0,0 +1,116 @@
+/**
+ *
+ * @file    rstools_block.h
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools block transfers between mapped device memory (HPS-to-FPGA Bridges,
+ * on-chip RAM, ...) and the application memory
+ *
+ * Device memory is accessed with aligned 32-bit words, because the
+ * Lightweight HPS-to-FPGA Bridge and most soft-IP slaves do not support
+ * narrower or unaligned accesses. Block writes to memory behind the 64/128-bit
+ * HPS-to-FPGA Bridge or the MPU address space (e.g. on-chip RAM) can also use
+ * 64-bit or 128-bit stores (NEON on ARM).
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Block writes to device memory
+ * 		1.20 (10-16-2026)
+ * 		Vectorized search of differing words
+ * 		1.30 (10-16-2026)
+ * 		Shared write of a buffer to a file descriptor
+ * 		1.40 (10-16-2026)
+ * 		64-bit and 128-bit block writes to device memory
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef RSTOOLS_BLOCK_H
+#define RSTOOLS_BLOCK_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+// Chunk size of the block transfers between device memory and files
+#define RSBLOCK_CHUNK_SIZE		(1024UL*1024UL)
+
+// Store widths of the block writes in bits
+#define RSBLOCK_WIDTH_32		32
+#define RSBLOCK_WIDTH_64		64
+#define RSBLOCK_WIDTH_128		128
+
+/*
+*   @brief               Copy a device memory range into a buffer
+*   @param	dst			 destination buffer
+*   @param	src			 mapped device memory (32-bit aligned)
+*   @param	length		 number of bytes (multiple of 4)
+*/
+void rsBlockCopyFromDev(void* dst, const volatile uint32_t* src, size_t length);
+
+/*
+*   @brief               Copy a buffer into a device memory range
+*   @param	dst			 mapped device memory (32-bit aligned)
+*   @param	src			 source buffer
+*   @param	length		 number of bytes (multiple of 4)
+*/
+void rsBlockCopyToDev(volatile uint32_t* dst, const void* src, size_t length);
+
+/*
+*   @brief               Copy a buffer into a device memory range with wide stores
+*						 (64-bit: one 64-bit store, 128-bit: one NEON vst1 on ARM or
+*						 a store of the vector type of the compiler)
+*   @param	dst			 mapped device memory (aligned to the store width)
+*   @param	src			 source buffer (32-bit aligned)
+*   @param	length		 number of bytes (multiple of the store width in bytes)
+*   @param	width		 store width in bits (32, 64 or 128)
+*/
+void rsBlockCopyToDevWide(volatile void* dst, const void* src, size_t length, uint8_t width);
+
+/*
+*   @brief               Check a store width of the block writes (32, 64 or 128)
+*/
+bool rsBlockWidthValid(uint8_t width);
+
+/*
+*   @brief               Find the first differing word of two buffers (16 Byte vectors,
+*						 NEON on ARM, SSE2 on x86)
+*   @param	a			 first buffer (32-bit aligned)
+*   @param	b			 second buffer (32-bit aligned)
+*   @param	words		 number of 32-bit words of both buffers
+*   @param	start		 index of the first word to check
+*   @return              index of the first differing word or words if all are equal
+*/
+size_t rsBlockFindDiff(const uint32_t* a, const uint32_t* b, size_t words, size_t start);
+
+/*
+*   @brief               Find the first equal word of two buffers (end of a mismatch run)
+*   @return              index of the first equal word or words if all differ
+*/
+size_t rsBlockFindSame(const uint32_t* a, const uint32_t* b, size_t words, size_t start);
+
+/*
+*   @brief               Write a buffer to a file descriptor
+*						 (a pipe may accept only a part of it, EINTR is retried)
+*   @param	fd			 file descriptor to write to
+*   @param	buf			 data
+*   @param	length		 number of bytes
+*   @return              true if all bytes were written
+*/
+bool rsBlockWriteFd(int fd, const void* buf, size_t length);
+
+/*
+*   @brief               Copy a device memory range to a file descriptor in
+*						 chunks of RSBLOCK_CHUNK_SIZE
+*   @param	fd			 file descriptor to write to
+*   @param	src			 mapped device memory (32-bit aligned)
+*   @param	length		 number of bytes (multiple of 4)
+*   @return              true if all bytes were written
+*/
+bool rsBlockDevToFd(int fd, const volatile uint32_t* src, size_t length);
+
+#endif // RSTOOLS_BLOCK_H
@@ -0,0 +1,276 @@
+/**
+ *
+ * @file    rstools_client.cpp
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Client of the rstoolsd daemon
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Block write over the daemon
+ * 		1.20 (10-16-2026)
+ * 		Store width of the block write
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "rstools_client.h"
+#include "rstools_mem.h"			// return codes
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>					// POSIX: read, write, close
+#include <sys/socket.h>				// POSIX: socket, connect
+#include <sys/un.h>					// POSIX: sockaddr_un
+
+using namespace std;
+
+/*
+* Global Values
+*/
+
+static int client_fd = -1;
+static vector<uint8_t> txBuf;		// message buffers (reused for every batch)
+static vector<uint8_t> rxBuf;
+
+const char* rsClientSocketPath(void)
+{
+	const char* path = getenv(RSPROTO_ENV_SOCKET);
+	if ((path == nullptr) || (path[0] == '\0'))
+		path = RSPROTO_DEFAULT_SOCKET;
+	return path;
+}
+
+int rsClientOpen(const char* path)
+{
+	if (client_fd >= 0) return RSMEM_SUCCESS;
+	if (path == nullptr) path = rsClientSocketPath();
+
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) return RSMEM_ERR_INPUT;
+	strcpy(addr.sun_path, path);
+
+	client_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (client_fd < 0) return RSMEM_ERR_DRIVER;
+	if (connect(client_fd, (struct sockaddr*) &addr, sizeof(addr)) != 0)
+	{
+		close(client_fd);
+		client_fd = -1;
+		return RSMEM_ERR_DRIVER;
+	}
+	return RSMEM_SUCCESS;
+}
+
+void rsClientClose(void)
+{
+	if (client_fd >= 0)
+		close(client_fd);
+	client_fd = -1;
+}
+
+/*
+*   @brief               Transfer one message with count operations
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+static int transferMessage(rsClientOp_t* ops, size_t count)
+{
+	// Request message
+	size_t len = sizeof(rsProtoHeader_t);
+	for (size_t i = 0; i < count; i++)
+		len += sizeof(rsProtoReq_t) + ops[i].payloadLen;
+	txBuf.resize(len);
+
+	rsProtoHeader_t header;
+	header.magic = RSPROTO_MAGIC;
+	header.count = count;
+	header.reserved = 0;
+	header.length = len - sizeof(rsProtoHeader_t);
+	memcpy(txBuf.data(), &header, sizeof(header));
+
+	uint8_t* ptr = txBuf.data() + sizeof(header);
+	for (size_t i = 0; i < count; i++)
+	{
+		ops[i].req.length = ops[i].payloadLen;
+		memcpy(ptr, &ops[i].req, sizeof(rsProtoReq_t));
+		ptr += sizeof(rsProtoReq_t);
+		if (ops[i].payloadLen > 0)
+		{
+			memcpy(ptr, ops[i].payload, ops[i].payloadLen);
+			ptr += ops[i].payloadLen;
+		}
+	}
+
+	if (!rsProtoSendFull(client_fd, txBuf.data(), len))
+		return RSMEM_ERR_DRIVER;
+
+	// Response message
+	if (!rsProtoRecvFull(client_fd, &header, sizeof(header)) || (header.magic != RSPROTO_MAGIC) || \
+		(header.count != count) || (header.length > RSPROTO_MAX_MESSAGE))
+		return RSMEM_ERR_DRIVER;
+	rxBuf.resize(header.length);
+	if (!rsProtoRecvFull(client_fd, rxBuf.data(), header.length))
+		return RSMEM_ERR_DRIVER;
+
+	const uint8_t* rx = rxBuf.data();
+	const uint8_t* end = rx + header.length;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (rx + sizeof(rsProtoResp_t) > end) return RSMEM_ERR_DRIVER;
+		memcpy(&ops[i].resp, rx, sizeof(rsProtoResp_t));
+		rx += sizeof(rsProtoResp_t);
+
+		if ((ops[i].req.op == RSPROTO_OP_DUMP) && (ops[i].resp.status == RSMEM_SUCCESS))
+		{
+			size_t bytes = ops[i].resp.value;
+			if ((rx + bytes > end) || (bytes > ops[i].req.value)) return RSMEM_ERR_DRIVER;
+			if (ops[i].data != nullptr)
+				memcpy(ops[i].data, rx, bytes);
+			rx += bytes;
+		}
+	}
+	return RSMEM_SUCCESS;
+}
+
+int rsClientBatch(rsClientOp_t* ops, size_t count)
+{
+	if (client_fd < 0) return RSMEM_ERR_DRIVER;
+
+	// Split the batch into messages within the limits of the daemon
+	size_t first = 0;
+	while (first < count)
+	{
+		size_t n = 0;
+		size_t txLen = sizeof(rsProtoHeader_t);
+		size_t rxLen = sizeof(rsProtoHeader_t);
+		while ((first + n < count) && (n < RSPROTO_MAX_BATCH))
+		{
+			const rsClientOp_t& op = ops[first + n];
+			if ((op.payloadLen > RSPROTO_MAX_PAYLOAD) || \
+				((op.req.op == RSPROTO_OP_DUMP) && (op.req.value > RSPROTO_MAX_DUMP)))
+				return RSMEM_ERR_INPUT;
+
+			size_t tx = sizeof(rsProtoReq_t) + op.payloadLen;
+			size_t rx = sizeof(rsProtoResp_t) + ((op.req.op == RSPROTO_OP_DUMP) ? op.req.value : 0);
+			if ((n > 0) && ((txLen + tx > RSPROTO_MAX_MESSAGE) || (rxLen + rx > RSPROTO_MAX_MESSAGE)))
+				break;
+			txLen += tx;
+			rxLen += rx;
+			n++;
+		}
+
+		int res = transferMessage(ops + first, n);
+		if (res != RSMEM_SUCCESS)
+		{
+			// The stream is out of sync, the connection can not be used again
+			rsClientClose();
+			return res;
+		}
+		first += n;
+	}
+	return RSMEM_SUCCESS;
+}
+
+/*
+*   @brief               Transfer a single register operation
+*/
+static int singleOp(uint8_t opCode, uint32_t address, uint32_t value, uint32_t* result)
+{
+	rsClientOp_t op;
+	memset(&op, 0, sizeof(op));
+	op.req.op = opCode;
+	op.req.address = address;
+	op.req.value = value;
+
+	int res = rsClientBatch(&op, 1);
+	if (res != RSMEM_SUCCESS) return res;
+	if (result != nullptr) *result = op.resp.value;
+	return op.resp.status;
+}
+
+int rsClientRead(uint32_t address, uint32_t* value)
+{
+	return singleOp(RSPROTO_OP_READ, address, 0, value);
+}
+
+int rsClientWrite(uint32_t address, uint32_t value)
+{
+	return singleOp(RSPROTO_OP_WRITE, address, value, nullptr);
+}
+
+int rsClientSetBits(uint32_t address, uint32_t mask)
+{
+	return singleOp(RSPROTO_OP_SET, address, mask, nullptr);
+}
+
+int rsClientClearBits(uint32_t address, uint32_t mask)
+{
+	return singleOp(RSPROTO_OP_CLEAR, address, mask, nullptr);
+}
+
+int rsClientReadBlock(uint32_t address, void* dst, uint32_t length)
+{
+	vector<rsClientOp_t> ops((length + RSPROTO_MAX_DUMP - 1) / RSPROTO_MAX_DUMP);
+	for (size_t i = 0; i < ops.size(); i++)
+	{
+		uint32_t offset = i * RSPROTO_MAX_DUMP;
+		memset(&ops[i], 0, sizeof(rsClientOp_t));
+		ops[i].req.op = RSPROTO_OP_DUMP;
+		ops[i].req.address = address + offset;
+		ops[i].req.value = min<uint32_t>(RSPROTO_MAX_DUMP, length - offset);
+		ops[i].data = (uint8_t*) dst + offset;
+	}
+
+	int res = rsClientBatch(ops.data(), ops.size());
+	for (size_t i = 0; (res == RSMEM_SUCCESS) && (i < ops.size()); i++)
+	{
+		if (ops[i].resp.status != RSMEM_SUCCESS) res = ops[i].resp.status;
+		else if (ops[i].resp.value != ops[i].req.value) res = RSMEM_ERR_DRIVER;
+	}
+	return res;
+}
+
+int rsClientWriteBlock(uint32_t address, const void* src, uint32_t length, uint8_t width)
+{
+	vector<rsClientOp_t> ops((length + RSPROTO_MAX_PAYLOAD - 1) / RSPROTO_MAX_PAYLOAD);
+	for (size_t i = 0; i < ops.size(); i++)
+	{
+		uint32_t offset = i * RSPROTO_MAX_PAYLOAD;
+		memset(&ops[i], 0, sizeof(rsClientOp_t));
+		ops[i].req.op = RSPROTO_OP_WRITE_BLOCK;
+		ops[i].req.address = address + offset;
+		ops[i].req.value = width;
+		ops[i].payload = (const uint8_t*) src + offset;
+		ops[i].payloadLen = min<uint32_t>(RSPROTO_MAX_PAYLOAD, length - offset);
+	}
+
+	int res = rsClientBatch(ops.data(), ops.size());
+	for (size_t i = 0; (res == RSMEM_SUCCESS) && (i < ops.size()); i++)
+	{
+		if (ops[i].resp.status != RSMEM_SUCCESS) res = ops[i].resp.status;
+	}
+	return res;
+}
+
+int rsClientConfig(const char* path, uint32_t flags)
+{
+	rsClientOp_t op;
+	memset(&op, 0, sizeof(op));
+	size_t len = strlen(path);
+	if ((len == 0) || (len > RSPROTO_MAX_PAYLOAD)) return RSMEM_ERR_INPUT;
+	op.req.op = RSPROTO_OP_CONFIG;
+	op.req.value = flags;
+	op.payload = path;
+	op.payloadLen = len;
+
+	int res = rsClientBatch(&op, 1);
+	return (res != RSMEM_SUCCESS) ? res : op.resp.status;
+}
@@ -0,0 +1,111 @@
+/**
+ *
+ * @file    rstools_client.h
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Client of the rstoolsd daemon
+ *
+ * Operations are collected in a list and sent as one batch, e.g.:
+ * 		rsClientOp_t ops[2] = {};
+ * 		ops[0].req.op = RSPROTO_OP_WRITE; ops[0].req.address = a; ops[0].req.value = 1;
+ * 		ops[1].req.op = RSPROTO_OP_READ;  ops[1].req.address = b;
+ * 		rsClientBatch(ops, 2);
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Block write over the daemon
+ * 		1.20 (10-16-2026)
+ * 		Store width of the block write
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef RSTOOLS_CLIENT_H
+#define RSTOOLS_CLIENT_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+#include "rstools_proto.h"
+
+/*
+* One operation of a batch
+*/
+typedef struct
+{
+	rsProtoReq_t req;				// request (req.length is set from payload)
+	const void* payload;			// payload of the request (CONFIG: path, WRITE_BLOCK: data)
+	uint16_t payloadLen;			// bytes of the payload
+	void* data;						// DUMP: destination of req.value bytes
+	rsProtoResp_t resp;				// response of the daemon
+} rsClientOp_t;
+
+/*
+*   @brief               Socket of the daemon (RSTOOLS_SOCKET or the default)
+*/
+const char* rsClientSocketPath(void);
+
+/*
+*   @brief               Connect to the daemon
+*						 Calling it again with an open connection does nothing
+*   @param	path		 socket path (nullptr: rsClientSocketPath())
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int rsClientOpen(const char* path);
+
+/*
+*   @brief               Close the connection to the daemon
+*/
+void rsClientClose(void);
+
+/*
+*   @brief               Send a batch of operations and receive the responses
+*   @param	ops			 operations, the responses are written to ops[i].resp
+*   @param	count		 number of operations (any number, split into messages)
+*   @return              RSMEM_SUCCESS if the batch was transferred
+*						 (the result of each operation is in ops[i].resp.status)
+*						 or RSMEM_ERR_DRIVER/RSMEM_ERR_INPUT
+*/
+int rsClientBatch(rsClientOp_t* ops, size_t count);
+
+/*
+*   @brief               Single register operations over the daemon
+*   @return              RSMEM_SUCCESS or an error code
+*/
+int rsClientRead(uint32_t address, uint32_t* value);
+int rsClientWrite(uint32_t address, uint32_t value);
+int rsClientSetBits(uint32_t address, uint32_t mask);
+int rsClientClearBits(uint32_t address, uint32_t mask);
+
+/*
+*   @brief               Read a block of registers over the daemon (one batch)
+*   @param	address		 physical start address (32-bit aligned)
+*   @param	dst			 destination
+*   @param	length		 number of bytes (multiple of 4)
+*   @return              RSMEM_SUCCESS or an error code
+*/
+int rsClientReadBlock(uint32_t address, void* dst, uint32_t length);
+
+/*
+*   @brief               Write a block of registers over the daemon (one batch)
+*   @param	address		 physical start address (aligned to the store width)
+*   @param	src			 data
+*   @param	length		 number of bytes (multiple of the store width in bytes)
+*   @param	width		 store width of the daemon in bits (32, 64 or 128)
+*   @return              RSMEM_SUCCESS or an error code
+*/
+int rsClientWriteBlock(uint32_t address, const void* src, uint32_t length, uint8_t width = 32);
+
+/*
+*   @brief               Let the daemon write a FPGA configuration file
+*   @param	path		 rbf file (path as seen by the daemon)
+*   @param	flags		 RSPROTO_CONFIG_... flags
+*   @return              RSMEM_SUCCESS, RSMEM_ERR_INPUT or RSPROTO_ERR_CONFIG
+*/
+int rsClientConfig(const char* path, uint32_t flags);
+
+#endif // RSTOOLS_CLIENT_H
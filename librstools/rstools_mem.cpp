@@ -0,0 +1,319 @@
+/**
+ *
+ * @file    rstools_mem.cpp
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools shared register access layer with a per process mapping cache
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Register access over the rstoolsd daemon
+ * 		1.20 (10-16-2026)
+ * 		Block write (local or over the rstoolsd daemon)
+ * 		and length argument parser of the range modes
+ * 		1.30 (10-16-2026)
+ * 		Store width of the block write
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "rstools_mem.h"
+#include "rstools_client.h"			// rstoolsd daemon
+#include "rstools_block.h"			// block copy of device memory
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/mman.h>				// POSIX: memory maping
+#include <fcntl.h>					// POSIX: "PROT_WRITE", "MAP_SHARED", ...
+#include <unistd.h>					// POSIX: for closing the Linux driver access
+
+using namespace std;
+
+/*
+* Mapped window of the physical address space
+*/
+typedef struct
+{
+	uint64_t base;					// page aligned physical start address
+	uint64_t length;				// mapped length (multiple of MAP_SIZE)
+	uint8_t* virt;					// virtual address of the window
+} rsMemWindow_t;
+
+/*
+* Global Values
+*/
+
+static int posix_fd = -1;
+static bool remote = false;			// access over the rstoolsd daemon
+static vector<rsMemWindow_t> windows;
+static size_t lastWindow = 0;		// Index of the last used window
+
+/*
+*   @brief               Find a cached window that contains a range
+*   @param	start		 physical start address
+*   @param	end			 physical end address (exclusive)
+*   @return              window or nullptr
+*/
+static rsMemWindow_t* findWindow(uint64_t start, uint64_t end)
+{
+	// Most accesses hit the same window again
+	if (lastWindow < windows.size())
+	{
+		rsMemWindow_t* win = &windows[lastWindow];
+		if ((start >= win->base) && (end <= win->base + win->length))
+			return win;
+	}
+
+	for (size_t i = 0; i < windows.size(); i++)
+	{
+		if ((start >= windows[i].base) && (end <= windows[i].base + windows[i].length))
+		{
+			lastWindow = i;
+			return &windows[i];
+		}
+	}
+	return nullptr;
+}
+
+int rsMemSpaceAddress(const char* space, uint32_t offset, uint32_t* address)
+{
+	if (space == nullptr) return RSMEM_ERR_INPUT;
+	if (space[0] == '-') space++;
+
+	// GPO and GPI are fixed registers of the FPGA Manager
+	if (strcmp(space, "gpo") == 0)
+	{
+		*address = FPGAMAN_GPO_OFST;
+		return RSMEM_SUCCESS;
+	}
+	if (strcmp(space, "gpi") == 0)
+	{
+		*address = FPGAMAN_GPI_OFST;
+		return RSMEM_SUCCESS;
+	}
+
+	// Address must be a 32-bit address
+	if (offset % 4 > 0) return RSMEM_ERR_INPUT;
+
+	if (strcmp(space, "lw") == 0)
+	{
+		if (offset > LWH2F_RANGE) return RSMEM_ERR_INPUT;
+		*address = LWHPSFPGA_OFST + offset;
+	}
+	else if (strcmp(space, "hf") == 0)
+	{
+		if (offset > H2F_RANGE) return RSMEM_ERR_INPUT;
+		*address = HPSFPGA_OFST + offset;
+	}
+	else if (strcmp(space, "mpu") == 0)
+	{
+		*address = MPU_OFSET + offset;
+	}
+	else
+		return RSMEM_ERR_INPUT;
+
+	return RSMEM_SUCCESS;
+}
+
+int rsMemParseLength(const char* input, uint64_t* length)
+{
+	if (input == nullptr) return RSMEM_ERR_INPUT;
+	string str(input);
+
+	uint64_t scale = 1;
+	int base = 10;
+	if ((str.compare(0, 2, "0x") == 0) || (str.compare(0, 2, "0X") == 0))
+	{
+		str.erase(0, 2);
+		base = 16;
+	}
+	else if ((str.length() > 1) && ((str.back() == 'K') || (str.back() == 'k')))
+	{
+		scale = 1024;
+		str.pop_back();
+	}
+	else if ((str.length() > 1) && ((str.back() == 'M') || (str.back() == 'm')))
+	{
+		scale = 1024*1024;
+		str.pop_back();
+	}
+
+	if ((str.length() < 1) || (str.length() > 10) || \
+		(str.find_first_not_of((base == 16) ? "0123456789abcdefABCDEF" : "0123456789") != string::npos))
+		return RSMEM_ERR_INPUT;
+
+	*length = strtoull(str.c_str(), nullptr, base) * scale;
+	return RSMEM_SUCCESS;
+}
+
+/*
+*   @brief               Open the memory driver (or the stand-in file)
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+static int openDriver(void)
+{
+	if (posix_fd >= 0) return RSMEM_SUCCESS;
+
+	const char* dev = getenv(RSMEM_ENV_DEV);
+	if ((dev == nullptr) || (dev[0] == '\0'))
+		dev = RSMEM_DEFAULT_DEV;
+
+	// open memory driver
+	posix_fd = open(dev, (O_RDWR | O_SYNC));
+
+	return (posix_fd < 0) ? RSMEM_ERR_DRIVER : RSMEM_SUCCESS;
+}
+
+int rsMemOpen(void)
+{
+	if ((posix_fd >= 0) || remote) return RSMEM_SUCCESS;
+
+	// Use the daemon if the environment selects it
+	const char* socket = getenv(RSPROTO_ENV_SOCKET);
+	if ((socket != nullptr) && (socket[0] != '\0'))
+	{
+		if (rsClientOpen(socket) != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+		remote = true;
+		return RSMEM_SUCCESS;
+	}
+
+	return openDriver();
+}
+
+void rsMemClose(void)
+{
+	// Close all MAPs
+	for (size_t i = 0; i < windows.size(); i++)
+	{
+		munmap(windows[i].virt, windows[i].length);
+	}
+	windows.clear();
+	lastWindow = 0;
+
+	// Close the driver port
+	if (posix_fd >= 0)
+		close(posix_fd);
+	posix_fd = -1;
+
+	if (remote)
+		rsClientClose();
+	remote = false;
+}
+
+bool rsMemIsRemote(void)
+{
+	return remote;
+}
+
+volatile uint32_t* rsMemMap(uint32_t address, uint32_t length)
+{
+	uint64_t start = address;
+	uint64_t end   = start + (length > 0 ? length : 4);
+
+	rsMemWindow_t* win = findWindow(start, end);
+	if (win != nullptr)
+		return (volatile uint32_t*)(win->virt + (start - win->base));
+
+	// Windows are always mapped by the process itself (also with the daemon)
+	if (openDriver() != RSMEM_SUCCESS) return nullptr;
+
+	// configure a new page aligned virtual memory window
+	rsMemWindow_t newWin;
+	newWin.base   = start & ~((uint64_t)MAP_MASK);
+	newWin.length = ((end - newWin.base) + MAP_MASK) & ~((uint64_t)MAP_MASK);
+
+	void* map = mmap(NULL, newWin.length, (PROT_READ | PROT_WRITE), MAP_SHARED, posix_fd, \
+		(off_t) newWin.base);
+
+	// check if opening was successfully
+	if (map == MAP_FAILED) return nullptr;
+
+	newWin.virt = (uint8_t*) map;
+	windows.push_back(newWin);
+	lastWindow = windows.size() - 1;
+
+	return (volatile uint32_t*)(newWin.virt + (start - newWin.base));
+}
+
+int rsMemRead(uint32_t address, uint32_t* value)
+{
+	if (rsMemOpen() != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+	if (remote) return rsClientRead(address, value);
+
+	volatile uint32_t* reg = rsMemMap(address, 4);
+	if (reg == nullptr) return RSMEM_ERR_DRIVER;
+
+	*value = *reg;
+	return RSMEM_SUCCESS;
+}
+
+int rsMemWrite(uint32_t address, uint32_t value)
+{
+	if (rsMemOpen() != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+	if (remote) return rsClientWrite(address, value);
+
+	volatile uint32_t* reg = rsMemMap(address, 4);
+	if (reg == nullptr) return RSMEM_ERR_DRIVER;
+
+	*reg = value;
+	return RSMEM_SUCCESS;
+}
+
+int rsMemSetBits(uint32_t address, uint32_t mask)
+{
+	if (rsMemOpen() != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+	if (remote) return rsClientSetBits(address, mask);
+
+	volatile uint32_t* reg = rsMemMap(address, 4);
+	if (reg == nullptr) return RSMEM_ERR_DRIVER;
+
+	*reg |= mask;
+	return RSMEM_SUCCESS;
+}
+
+int rsMemClearBits(uint32_t address, uint32_t mask)
+{
+	if (rsMemOpen() != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+	if (remote) return rsClientClearBits(address, mask);
+
+	volatile uint32_t* reg = rsMemMap(address, 4);
+	if (reg == nullptr) return RSMEM_ERR_DRIVER;
+
+	*reg &= ~mask;
+	return RSMEM_SUCCESS;
+}
+
+int rsMemReadBlock(uint32_t address, void* dst, uint32_t length)
+{
+	if (rsMemOpen() != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+	if (remote) return rsClientReadBlock(address, dst, length);
+
+	volatile uint32_t* reg = rsMemMap(address, length);
+	if (reg == nullptr) return RSMEM_ERR_DRIVER;
+
+	rsBlockCopyFromDev(dst, reg, length);
+	return RSMEM_SUCCESS;
+}
+
+int rsMemWriteBlock(uint32_t address, const void* src, uint32_t length, uint8_t width)
+{
+	uint32_t align = width / 8;
+	if (!rsBlockWidthValid(width) || (address % align != 0) || (length % align != 0))
+		return RSMEM_ERR_INPUT;
+
+	if (rsMemOpen() != RSMEM_SUCCESS) return RSMEM_ERR_DRIVER;
+	if (remote) return rsClientWriteBlock(address, src, length, width);
+
+	volatile uint32_t* reg = rsMemMap(address, length);
+	if (reg == nullptr) return RSMEM_ERR_DRIVER;
+
+	rsBlockCopyToDevWide(reg, src, length, width);
+	return RSMEM_SUCCESS;
+}
@@ -0,0 +1,184 @@
+/**
+ *
+ * @file    rstools_mem.h
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools shared register access layer for the HPS-to-FPGA Bridges
+ * and the MPU address space
+ *
+ * All rstools applications access the physical address space through
+ * this layer. The memory driver is opened once per process and every
+ * mapped window is kept in a cache, so that following accesses to the same
+ * page or window do not pay for open/mmap/munmap again.
+ *
+ * With the environment variable RSTOOLS_MEM_DEV a regular (sparse) file
+ * can be used as stand-in for /dev/mem. The file offset is the physical
+ * address, e.g.:
+ * 		truncate -s 4G /tmp/rsmem && RSTOOLS_MEM_DEV=/tmp/rsmem FPGA-readBridge -lw 0
+ *
+ * With the environment variable RSTOOLS_SOCKET (path of the socket) the
+ * register functions (rsMemRead, rsMemWrite, rsMemSetBits, rsMemClearBits,
+ * rsMemReadBlock, rsMemWriteBlock) are served by the rstoolsd daemon, that holds
+ * the driver and all windows open. rsMemMap() still maps the window in the
+ * process itself, the application needs the access rights of the memory driver
+ * for it. Range modes use the block functions to work with both.
+ *
+ * rsMemWriteBlock writes 32-bit words by default. Ranges of the HPS-to-FPGA
+ * Bridge and the MPU address space may be written with 64-bit or 128-bit stores
+ * (the Lightweight Bridge only accepts 32-bit accesses), rstoolsd uses the
+ * store width of the request.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Register access over the rstoolsd daemon
+ * 		1.20 (10-16-2026)
+ * 		Block write (local or over the rstoolsd daemon)
+ * 		and length argument parser of the range modes
+ * 		1.30 (10-16-2026)
+ * 		Store width of the block write
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef RSTOOLS_MEM_H
+#define RSTOOLS_MEM_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+// Bridge Interfaces Base addresses
+#define LWHPSFPGA_OFST  	0xff200000 // LWHPS2FPGA Bridge
+#define HPSFPGA_OFST    	0xC0000000 // HPS2FPGA Bridge
+#define MPU_OFSET			0x0        // MPU (HPS Address space)
+
+// Bridge interface End address
+#define LWHPSFPGA_END   	0xFF3FFFFF
+#define HPSFPGA_END     	0xFBFFFFFF
+#define MPU_END         	0xFFFFFFFF
+
+// Bridge interface range (allowed input offset)
+#define LWH2F_RANGE    (LWHPSFPGA_END - LWHPSFPGA_OFST)
+#define H2F_RANGE      (HPSFPGA_END - HPSFPGA_OFST)
+#define MPU_RANGE      (MPU_END - MPU_OFSET)
+
+// FPGA Manager General-Purpose Output (HPS->FPGA) and Input (FPGA->HPS) Register
+#define FPGAMAN_GPO_OFST    0xFF706010
+#define FPGAMAN_GPI_OFST    0xFF706014
+
+#define MAP_SIZE 4096UL
+#define MAP_MASK (MAP_SIZE - 1)
+
+// Memory driver selection
+#define RSMEM_DEFAULT_DEV	"/dev/mem"			// Linux memory driver
+#define RSMEM_ENV_DEV		"RSTOOLS_MEM_DEV"	// Environment variable to select a stand-in file
+
+// Return codes (identical to the decimal console output of the rstools)
+#define RSMEM_SUCCESS		 1
+#define RSMEM_ERR_INPUT		-1		// Input Error
+#define RSMEM_ERR_DRIVER	-2		// Linux Kernel Memory Driver Error
+
+/*
+*   @brief               Convert an address space name and an offset to a physical address
+*						 and check that the address is a valid 32-bit address of the space
+*   @param	space		 "lw", "hf", "mpu", "gpo" or "gpi" (with or without leading "-")
+*						 For "gpo" and "gpi" the offset is ignored
+*   @param	offset		 address offset inside the space
+*   @param	address		 physical address
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_INPUT
+*/
+int rsMemSpaceAddress(const char* space, uint32_t offset, uint32_t* address);
+
+/*
+*   @brief               Read a length of a range argument
+*   @param	input		 length in DEC (with optional K or M suffix) or in HEX with "0x"
+*   @param	length		 read length in bytes
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_INPUT
+*/
+int rsMemParseLength(const char* input, uint64_t* length);
+
+/*
+*   @brief               Open the memory driver (or the stand-in file)
+*						 or connect to the rstoolsd daemon if RSTOOLS_SOCKET is set
+*						 Calling it again with an open driver does nothing
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int rsMemOpen(void);
+
+/*
+*   @brief               Remove all cached windows and close the memory driver
+*/
+void rsMemClose(void);
+
+/*
+*   @brief               Check if the registers are accessed over the rstoolsd daemon
+*/
+bool rsMemIsRemote(void);
+
+/*
+*   @brief               Get a pointer to a physical address range
+*						 The range is served from an already mapped window
+*						 or a new page aligned window is mapped and cached
+*   @param	address		 physical start address
+*   @param	length		 number of bytes that must be accessible
+*   @return              pointer to the address or nullptr if the mapping failed
+*/
+volatile uint32_t* rsMemMap(uint32_t address, uint32_t length);
+
+/*
+*   @brief               Read a 32-bit register
+*   @param	address		 physical address (32-bit aligned)
+*   @param	value		 read value
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int rsMemRead(uint32_t address, uint32_t* value);
+
+/*
+*   @brief               Write a 32-bit register
+*   @param	address		 physical address (32-bit aligned)
+*   @param	value		 value to write
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int rsMemWrite(uint32_t address, uint32_t value);
+
+/*
+*   @brief               Read-modify-write: set the bits of a mask
+*   @param	address		 physical address (32-bit aligned)
+*   @param	mask		 bits to set
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int rsMemSetBits(uint32_t address, uint32_t mask);
+
+/*
+*   @brief               Read-modify-write: clear the bits of a mask
+*   @param	address		 physical address (32-bit aligned)
+*   @param	mask		 bits to clear
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int rsMemClearBits(uint32_t address, uint32_t mask);
+
+/*
+*   @brief               Read a block of 32-bit registers
+*   @param	address		 physical start address (32-bit aligned)
+*   @param	dst			 destination
+*   @param	length		 number of bytes (multiple of 4)
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_DRIVER
+*/
+int rsMemReadBlock(uint32_t address, void* dst, uint32_t length);
+
+/*
+*   @brief               Write a block of registers or memory
+*   @param	address		 physical start address (aligned to the store width)
+*   @param	src			 data (32-bit aligned)
+*   @param	length		 number of bytes (multiple of the store width in bytes)
+*   @param	width		 store width in bits (32, 64 or 128)
+*   @return              RSMEM_SUCCESS, RSMEM_ERR_INPUT (width or alignment)
+*						 or RSMEM_ERR_DRIVER
+*/
+int rsMemWriteBlock(uint32_t address, const void* src, uint32_t length, uint8_t width = 32);
+
+#endif // RSTOOLS_MEM_H
@@ -0,0 +1,56 @@
+/**
+ *
+ * @file    rstools_proto.cpp
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Socket transfer of the rstoolsd protocol (client and daemon)
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "rstools_proto.h"
+
+#include <cerrno>
+#include <sys/socket.h>				// POSIX: send, recv
+
+bool rsProtoSendFull(int fd, const void* buf, size_t len)
+{
+	const uint8_t* ptr = (const uint8_t*) buf;
+	while (len > 0)
+	{
+		ssize_t res = send(fd, ptr, len, MSG_NOSIGNAL);
+		if (res < 0)
+		{
+			if (errno == EINTR) continue;
+			return false;
+		}
+		ptr += res;
+		len -= res;
+	}
+	return true;
+}
+
+bool rsProtoRecvFull(int fd, void* buf, size_t len)
+{
+	uint8_t* ptr = (uint8_t*) buf;
+	while (len > 0)
+	{
+		ssize_t res = recv(fd, ptr, len, 0);
+		if (res < 0)
+		{
+			if (errno == EINTR) continue;
+			return false;
+		}
+		if (res == 0) return false;
+		ptr += res;
+		len -= res;
+	}
+	return true;
+}
@@ -0,0 +1,126 @@
+/**
+ *
+ * @file    rstools_proto.h
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * Binary protocol between the rstools applications and the rstoolsd daemon
+ *
+ * The daemon holds the memory driver and all mapped windows open and serves
+ * register operations over a Unix domain socket. A client sends a batch of
+ * requests in one message and gets one message with a response per request
+ * back, so a script with many register accesses pays for one round trip:
+ *
+ * 		request message:  rsProtoHeader_t, count * (rsProtoReq_t + payload)
+ * 		response message: rsProtoHeader_t, count * (rsProtoResp_t + data)
+ *
+ * The payload of a request (path of RSPROTO_OP_CONFIG, data of
+ * RSPROTO_OP_WRITE_BLOCK) has "length" bytes, the data of a response
+ * (bytes of RSPROTO_OP_DUMP) has "value" bytes.
+ * All values are in the byte order of the host (the socket is local).
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Block write operation and shared socket transfer functions
+ * 		1.20 (10-16-2026)
+ * 		Store width of the block write operation
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef RSTOOLS_PROTO_H
+#define RSTOOLS_PROTO_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+// Socket of the daemon
+#define RSPROTO_DEFAULT_SOCKET	"/run/rstools/rstoolsd.sock"
+#define RSPROTO_ENV_SOCKET		"RSTOOLS_SOCKET"	// Environment variable: use the daemon
+
+#define RSPROTO_MAGIC			0x31445352			// "RSD1"
+
+// Limits of a message
+#define RSPROTO_MAX_BATCH		1024				// requests per message
+#define RSPROTO_MAX_DUMP		(64*1024)			// bytes of one dump request
+#define RSPROTO_MAX_PAYLOAD		(32*1024)			// bytes of a request payload
+#define RSPROTO_MAX_MESSAGE		(4*1024*1024)		// bytes of a message
+
+// Flags of a RSPROTO_OP_CONFIG request (value)
+#define RSPROTO_CONFIG_CACHE	(1<<0)				// FPGA-writeConfig -cache
+#define RSPROTO_CONFIG_FORCE	(1<<1)				// FPGA-writeConfig -force
+#define RSPROTO_CONFIG_DMA		(1<<2)				// FPGA-writeConfig -dma
+
+// Additional return code of the daemon
+#define RSPROTO_ERR_CONFIG		-3					// FPGA configuration failed
+
+/*
+* Operations
+*/
+typedef enum
+{
+	RSPROTO_OP_NOP = 0,				// no operation (connection check)
+	RSPROTO_OP_READ = 1,			// read the register at "address"
+	RSPROTO_OP_WRITE = 2,			// write "value" to the register
+	RSPROTO_OP_SET = 3,				// set the bits of the mask "value"
+	RSPROTO_OP_CLEAR = 4,			// clear the bits of the mask "value"
+	RSPROTO_OP_DUMP = 5,			// read "value" bytes from "address"
+	RSPROTO_OP_CONFIG = 6,			// write the FPGA configuration file of the payload (flags: "value")
+	RSPROTO_OP_WRITE_BLOCK = 7		// write the payload to "address" (store width in bits: "value", 0: 32)
+} rsProtoOp_t;
+
+/*
+* Header of a message
+*/
+typedef struct __attribute__((packed))
+{
+	uint32_t magic;					// RSPROTO_MAGIC
+	uint16_t count;					// number of requests or responses
+	uint16_t reserved;
+	uint32_t length;				// bytes of the message behind the header
+} rsProtoHeader_t;
+
+/*
+* Request
+*/
+typedef struct __attribute__((packed))
+{
+	uint8_t op;						// rsProtoOp_t
+	uint8_t reserved;
+	uint16_t length;				// bytes of the payload behind the request
+	uint32_t address;				// physical address
+	uint32_t value;					// value, mask or number of bytes
+} rsProtoReq_t;
+
+/*
+* Response
+*/
+typedef struct __attribute__((packed))
+{
+	int32_t status;					// RSMEM_SUCCESS or an error code
+	uint32_t value;					// read value or number of bytes behind the response
+} rsProtoResp_t;
+
+/*
+*   @brief               Send exactly len bytes over a socket
+*   @param	fd			 socket
+*   @param	buf			 data
+*   @param	len			 number of bytes
+*   @return              success
+*/
+bool rsProtoSendFull(int fd, const void* buf, size_t len);
+
+/*
+*   @brief               Receive exactly len bytes from a socket
+*   @param	fd			 socket
+*   @param	buf			 destination
+*   @param	len			 number of bytes
+*   @return              success (false if the connection was closed)
+*/
+bool rsProtoRecvFull(int fd, void* buf, size_t len);
+
+#endif // RSTOOLS_PROTO_H
@@ -0,0 +1,677 @@
+/**
+ *
+ * @file    rstools_regs.cpp
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools register database of the HPS (name -> address, width, fields)
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		FPGA Manager registers and fields from the macros of alt_fpgamgr.h
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "rstools_regs.h"
+#include "rstools_mem.h"			// return codes
+#include "alt_fpgamgr.h"			// FPGA Manager register offsets and fields
+#include "alt_fpgamgrdata.h"		// FPGA Manager data register offset
+
+#include <cstring>
+
+using namespace std;
+
+#define REG_FIELD(name, lsb, width)				{ name, nullptr, lsb, width, nullptr, 0 }
+#define REG_FIELD_ALIAS(name, alias, lsb, width, enums) \
+	{ name, alias, lsb, width, enums, sizeof(enums) / sizeof(enums[0]) }
+#define REG_FIELD_ENUM(name, lsb, width, enums)	REG_FIELD_ALIAS(name, nullptr, lsb, width, enums)
+#define REG_ENTRY(name, address, fields) \
+	{ name, address, 32, fields, sizeof(fields) / sizeof(fields[0]) }
+
+/*
+* The FPGA Manager entries are built from the ALT_FPGAMGR_* and ALT_MON_GPIO_*
+* macros of alt_fpgamgr.h. Only the module base addresses are taken from hps.h,
+* that header maps the registers and can not be included here.
+*/
+#define FPGAMGR_BASE				0xFF706000		// ALT_FPGAMGR_OFST
+#define FPGAMGR_MON_BASE			(FPGAMGR_BASE + 0x800)	// ALT_FPGAMGR_MON_OFST
+#define FPGAMGRDATA_BASE			0xFFB90000		// ALT_FPGAMGRDATA_OFST
+
+#define FPGAMGR_ENUM(reg, field, value)		{ ALT_FPGAMGR_##reg##_##field##_E_##value, #value }
+#define FPGAMGR_FIELD(reg, field) \
+	REG_FIELD(#field, ALT_FPGAMGR_##reg##_##field##_LSB, ALT_FPGAMGR_##reg##_##field##_WIDTH)
+#define FPGAMGR_FIELD_ENUM(reg, field, enums) \
+	REG_FIELD_ENUM(#field, ALT_FPGAMGR_##reg##_##field##_LSB, ALT_FPGAMGR_##reg##_##field##_WIDTH, enums)
+#define MON_GPIO_FIELD(reg, field) \
+	REG_FIELD(#field, ALT_MON_GPIO_##reg##_##field##_LSB, ALT_MON_GPIO_##reg##_##field##_WIDTH)
+#define FPGAMGR_REG(reg, fields) \
+	REG_ENTRY("FPGAMGR_" #reg, FPGAMGR_BASE + ALT_FPGAMGR_##reg##_OFST, fields)
+#define MON_GPIO_REG(reg, fields) \
+	REG_ENTRY("FPGAMGR_MON_GPIO_" #reg, FPGAMGR_MON_BASE + ALT_MON_GPIO_##reg##_OFST, fields)
+
+/*
+* Named field values
+*/
+
+// FPGA Manager (alt_fpgamgr.h)
+static constexpr rsRegEnum_t fpgamgrStatMod[] =
+{
+	FPGAMGR_ENUM(STAT, MOD, FPGAOFF), FPGAMGR_ENUM(STAT, MOD, RSTPHASE),
+	FPGAMGR_ENUM(STAT, MOD, CFGPHASE), FPGAMGR_ENUM(STAT, MOD, INITPHASE),
+	FPGAMGR_ENUM(STAT, MOD, USERMOD), FPGAMGR_ENUM(STAT, MOD, UNKNOWN)
+};
+
+static constexpr rsRegEnum_t fpgamgrStatMsel[] =
+{
+	FPGAMGR_ENUM(STAT, MSEL, PP16_FAST_NOAES_NODC), FPGAMGR_ENUM(STAT, MSEL, PP16_FAST_AES_NODC),
+	FPGAMGR_ENUM(STAT, MSEL, PP16_FAST_AESOPT_DC), FPGAMGR_ENUM(STAT, MSEL, PP16_SLOW_NOAES_NODC),
+	FPGAMGR_ENUM(STAT, MSEL, PP16_SLOW_AES_NODC), FPGAMGR_ENUM(STAT, MSEL, PP16_SLOW_AESOPT_DC),
+	FPGAMGR_ENUM(STAT, MSEL, PP32_FAST_NOAES_NODC), FPGAMGR_ENUM(STAT, MSEL, PP32_FAST_AES_NODC),
+	FPGAMGR_ENUM(STAT, MSEL, PP32_FAST_AESOPT_DC), FPGAMGR_ENUM(STAT, MSEL, PP32_SLOW_NOAES_NODC),
+	FPGAMGR_ENUM(STAT, MSEL, PP32_SLOW_AES_NODC), FPGAMGR_ENUM(STAT, MSEL, PP32_SLOW_AESOPT_DC)
+};
+
+static constexpr rsRegEnum_t fpgamgrCtlEn[] =
+{
+	FPGAMGR_ENUM(CTL, EN, FPGA_PINS_CTL_CFG), FPGAMGR_ENUM(CTL, EN, FPGAMGR_CTLS_CFG)
+};
+
+static constexpr rsRegEnum_t fpgamgrCtlCdratio[] =
+{
+	FPGAMGR_ENUM(CTL, CDRATIO, X1), FPGAMGR_ENUM(CTL, CDRATIO, X2),
+	FPGAMGR_ENUM(CTL, CDRATIO, X4), FPGAMGR_ENUM(CTL, CDRATIO, X8)
+};
+
+static constexpr rsRegEnum_t fpgamgrCtlCfgwdth[] =
+{
+	FPGAMGR_ENUM(CTL, CFGWDTH, PPX16), FPGAMGR_ENUM(CTL, CFGWDTH, PPX32)
+};
+
+static constexpr rsRegEnum_t fpgamgrDclkstatDcntdone[] =
+{
+	FPGAMGR_ENUM(DCLKSTAT, DCNTDONE, NOTDONE), FPGAMGR_ENUM(DCLKSTAT, DCNTDONE, DONE)
+};
+
+// System Manager
+static constexpr rsRegEnum_t sysmgrBootBsel[] =
+{
+	{ 0x0, "RSVD" }, { 0x1, "FPGA" }, { 0x2, "NAND_1_8V" }, { 0x3, "NAND_3_0V" },
+	{ 0x4, "SDMMC_1_8V" }, { 0x5, "SDMMC_3_0V" }, { 0x6, "QSPI_1_8V" }, { 0x7, "QSPI_3_0V" }
+};
+
+/*
+* Register fields
+*/
+
+static constexpr rsRegField_t value32Fields[] = { REG_FIELD("VALUE", 0, 32) };
+
+static constexpr rsRegField_t fpgamgrStatFields[] =
+{
+	REG_FIELD_ALIAS("MOD", "MODE", ALT_FPGAMGR_STAT_MOD_LSB, ALT_FPGAMGR_STAT_MOD_WIDTH, fpgamgrStatMod),
+	FPGAMGR_FIELD_ENUM(STAT, MSEL, fpgamgrStatMsel)
+};
+
+static constexpr rsRegField_t fpgamgrCtlFields[] =
+{
+	FPGAMGR_FIELD_ENUM(CTL, EN, fpgamgrCtlEn),
+	FPGAMGR_FIELD(CTL, NCE),
+	FPGAMGR_FIELD(CTL, NCFGPULL),
+	FPGAMGR_FIELD(CTL, NSTATPULL),
+	FPGAMGR_FIELD(CTL, CONFDONEPULL),
+	FPGAMGR_FIELD(CTL, PRREQ),
+	FPGAMGR_FIELD_ENUM(CTL, CDRATIO, fpgamgrCtlCdratio),
+	FPGAMGR_FIELD(CTL, AXICFGEN),
+	FPGAMGR_FIELD_ENUM(CTL, CFGWDTH, fpgamgrCtlCfgwdth)
+};
+
+static constexpr rsRegField_t fpgamgrDclkcntFields[] = { FPGAMGR_FIELD(DCLKCNT, CNT) };
+
+static constexpr rsRegField_t fpgamgrDclkstatFields[] =
+{
+	FPGAMGR_FIELD_ENUM(DCLKSTAT, DCNTDONE, fpgamgrDclkstatDcntdone)
+};
+
+static constexpr rsRegField_t fpgamgrGpoFields[] = { FPGAMGR_FIELD(GPO, VALUE) };
+static constexpr rsRegField_t fpgamgrGpiFields[] = { FPGAMGR_FIELD(GPI, VALUE) };
+
+static constexpr rsRegField_t fpgamgrMisciFields[] =
+{
+	FPGAMGR_FIELD(MISCI, BOOTFPGAFAIL),
+	FPGAMGR_FIELD(MISCI, BOOTFPGARDY)
+};
+
+// Configuration Monitor (one bit per monitored signal, the same layout in all
+// interrupt and port registers)
+static constexpr rsRegField_t fpgamgrMonGpioFields[] =
+{
+	MON_GPIO_FIELD(INTEN, NS), MON_GPIO_FIELD(INTEN, CD), MON_GPIO_FIELD(INTEN, ID),
+	MON_GPIO_FIELD(INTEN, CRC), MON_GPIO_FIELD(INTEN, CCD), MON_GPIO_FIELD(INTEN, PRR),
+	MON_GPIO_FIELD(INTEN, PRE), MON_GPIO_FIELD(INTEN, PRD), MON_GPIO_FIELD(INTEN, NCP),
+	MON_GPIO_FIELD(INTEN, NSP), MON_GPIO_FIELD(INTEN, CDP), MON_GPIO_FIELD(INTEN, FPO)
+};
+
+static constexpr rsRegField_t fpgamgrMonLsSyncFields[] = { MON_GPIO_FIELD(LS_SYNC, GPIO_LS_SYNC) };
+
+static constexpr rsRegField_t fpgamgrMonVerIdCodeFields[] =
+{
+	REG_FIELD("VALUE", ALT_MON_GPIO_VER_ID_CODE_GPIO_VER_ID_CODE_LSB, ALT_MON_GPIO_VER_ID_CODE_GPIO_VER_ID_CODE_WIDTH)
+};
+
+static constexpr rsRegField_t fpgamgrMonCfgReg2Fields[] =
+{
+	MON_GPIO_FIELD(CFG_REG2, ENC_ID_PWIDTH_A),
+	MON_GPIO_FIELD(CFG_REG2, ENC_ID_PWIDTH_B),
+	MON_GPIO_FIELD(CFG_REG2, ENC_ID_PWIDTH_C),
+	MON_GPIO_FIELD(CFG_REG2, ENC_ID_PWIDTH_D)
+};
+
+static constexpr rsRegField_t fpgamgrMonCfgReg1Fields[] =
+{
+	MON_GPIO_FIELD(CFG_REG1, APB_DATA_WIDTH),
+	MON_GPIO_FIELD(CFG_REG1, NUM_PORTS),
+	MON_GPIO_FIELD(CFG_REG1, PORTA_SINGLE_CTL),
+	MON_GPIO_FIELD(CFG_REG1, PORTB_SINGLE_CTL),
+	MON_GPIO_FIELD(CFG_REG1, PORTC_SINGLE_CTL),
+	MON_GPIO_FIELD(CFG_REG1, PORTD_SINGLE_CTL),
+	MON_GPIO_FIELD(CFG_REG1, HW_PORTA),
+	MON_GPIO_FIELD(CFG_REG1, PORTA_INTR),
+	MON_GPIO_FIELD(CFG_REG1, DEBOUNCE),
+	MON_GPIO_FIELD(CFG_REG1, ADD_ENC_PARAMS),
+	MON_GPIO_FIELD(CFG_REG1, GPIO_ID),
+	MON_GPIO_FIELD(CFG_REG1, ENC_ID_WIDTH)
+};
+
+static constexpr rsRegField_t fpgamgrDataFields[] =
+{
+	REG_FIELD("VALUE", ALT_FPGAMGRDATA_DATA_FLD_LSB, ALT_FPGAMGRDATA_DATA_FLD_WIDTH)
+};
+
+// WatchDog 0 and 1
+static constexpr rsRegField_t l4wdCrFields[] =
+{
+	REG_FIELD("WDT_EN", 0, 1),
+	REG_FIELD("RMOD", 1, 1),
+	REG_FIELD("RPL", 2, 3)
+};
+
+static constexpr rsRegField_t l4wdTorrFields[] =
+{
+	REG_FIELD("TOP", 0, 4),
+	REG_FIELD("TOP_INIT", 4, 4)
+};
+
+static constexpr rsRegField_t l4wdCrrFields[] = { REG_FIELD("VALUE", 0, 8) };
+static constexpr rsRegField_t value1Fields[] = { REG_FIELD("VALUE", 0, 1) };
+
+// Clock Manager
+static constexpr rsRegField_t clkmgrCtlFields[] =
+{
+	REG_FIELD("SAFEMOD", 0, 1),
+	REG_FIELD("ENSFMDWR", 2, 1)
+};
+
+static constexpr rsRegField_t clkmgrBypassFields[] =
+{
+	REG_FIELD("MAINPLL", 0, 1),
+	REG_FIELD("SDRPLL", 1, 1),
+	REG_FIELD("SDRPLLSRC", 2, 1),
+	REG_FIELD("PERPLL", 3, 1),
+	REG_FIELD("PERPLLSRC", 4, 1)
+};
+
+static constexpr rsRegField_t clkmgrInterFields[] =
+{
+	REG_FIELD("MAINPLLACHIEVED", 0, 1),
+	REG_FIELD("PERPLLACHIEVED", 1, 1),
+	REG_FIELD("SDRPLLACHIEVED", 2, 1),
+	REG_FIELD("MAINPLLLOST", 3, 1),
+	REG_FIELD("PERPLLLOST", 4, 1),
+	REG_FIELD("SDRPLLLOST", 5, 1),
+	REG_FIELD("MAINPLLLOCKED", 6, 1),
+	REG_FIELD("PERPLLLOCKED", 7, 1),
+	REG_FIELD("SDRPLLLOCKED", 8, 1)
+};
+
+static constexpr rsRegField_t clkmgrIntrenFields[] =
+{
+	REG_FIELD("MAINPLLACHIEVED", 0, 1),
+	REG_FIELD("PERPLLACHIEVED", 1, 1),
+	REG_FIELD("SDRPLLACHIEVED", 2, 1),
+	REG_FIELD("MAINPLLLOST", 3, 1),
+	REG_FIELD("PERPLLLOST", 4, 1),
+	REG_FIELD("SDRPLLLOST", 5, 1)
+};
+
+static constexpr rsRegField_t clkmgrDbctlFields[] =
+{
+	REG_FIELD("STAYOSC1", 0, 1),
+	REG_FIELD("ENSFMDWR", 1, 1)
+};
+
+static constexpr rsRegField_t clkmgrStatFields[] = { REG_FIELD("BUSY", 0, 1) };
+
+// Reset Manager
+static constexpr rsRegField_t rstmgrStatFields[] =
+{
+	REG_FIELD("PORVOLTRST", 0, 1),
+	REG_FIELD("NPORPINRST", 1, 1),
+	REG_FIELD("FPGACOLDRST", 2, 1),
+	REG_FIELD("CONFIGIOCOLDRST", 3, 1),
+	REG_FIELD("SWCOLDRST", 8, 1),
+	REG_FIELD("NRSTPINRST", 9, 1),
+	REG_FIELD("FPGAWARMRST", 10, 1),
+	REG_FIELD("SWWARMRST", 11, 1),
+	REG_FIELD("MPUWD0RST", 13, 1),
+	REG_FIELD("MPUWD1RST", 14, 1),
+	REG_FIELD("L4WD0RST", 15, 1),
+	REG_FIELD("L4WD1RST", 16, 1),
+	REG_FIELD("FPGADBGRST", 18, 1),
+	REG_FIELD("CDBGREQRST", 19, 1),
+	REG_FIELD("SDRSELFREFTMO", 24, 1),
+	REG_FIELD("FPGAMGRHSTMO", 25, 1),
+	REG_FIELD("SCANHSTMO", 26, 1),
+	REG_FIELD("FPGAHSTMO", 27, 1),
+	REG_FIELD("ETRSTALLTMO", 28, 1)
+};
+
+static constexpr rsRegField_t rstmgrCtlFields[] =
+{
+	REG_FIELD("SWCOLDRSTREQ", 0, 1),
+	REG_FIELD("SWWARMRSTREQ", 1, 1),
+	REG_FIELD("SDRSELFREFREQ", 4, 1),
+	REG_FIELD("SDRSELFREQACK", 5, 1),
+	REG_FIELD("FPGAMGRHSEN", 8, 1),
+	REG_FIELD("FPGAMGRHSREQ", 9, 1),
+	REG_FIELD("FPGAMGRHSACK", 10, 1),
+	REG_FIELD("SCANMGRHSEN", 12, 1),
+	REG_FIELD("SCANMGRHSREQ", 13, 1),
+	REG_FIELD("SCANMGRHSACK", 14, 1),
+	REG_FIELD("FPGAHSEN", 16, 1),
+	REG_FIELD("FPGAHSREQ", 17, 1),
+	REG_FIELD("FPGAHSACK", 18, 1),
+	REG_FIELD("ETRSTALLEN", 20, 1),
+	REG_FIELD("ETRSTALLREQ", 21, 1),
+	REG_FIELD("ETRSTALLACK", 22, 1),
+	REG_FIELD("ETRSTALLWARMRST", 23, 1)
+};
+
+static constexpr rsRegField_t rstmgrCountsFields[] =
+{
+	REG_FIELD("WARMRSTCYCLES", 0, 8),
+	REG_FIELD("NRSTCNT", 8, 20)
+};
+
+static constexpr rsRegField_t rstmgrMpumodrstFields[] =
+{
+	REG_FIELD("CPU0", 0, 1),
+	REG_FIELD("CPU1", 1, 1),
+	REG_FIELD("WDS", 2, 1),
+	REG_FIELD("SCUPER", 3, 1),
+	REG_FIELD("L2", 4, 1)
+};
+
+static constexpr rsRegField_t rstmgrPermodrstFields[] =
+{
+	REG_FIELD("EMAC0", 0, 1), REG_FIELD("EMAC1", 1, 1), REG_FIELD("USB0", 2, 1),
+	REG_FIELD("USB1", 3, 1), REG_FIELD("NAND", 4, 1), REG_FIELD("QSPI", 5, 1),
+	REG_FIELD("L4WD0", 6, 1), REG_FIELD("L4WD1", 7, 1), REG_FIELD("OSC1TMR0", 8, 1),
+	REG_FIELD("OSC1TMR1", 9, 1), REG_FIELD("SPTMR0", 10, 1), REG_FIELD("SPTMR1", 11, 1),
+	REG_FIELD("I2C0", 12, 1), REG_FIELD("I2C1", 13, 1), REG_FIELD("I2C2", 14, 1),
+	REG_FIELD("I2C3", 15, 1), REG_FIELD("UART0", 16, 1), REG_FIELD("UART1", 17, 1),
+	REG_FIELD("SPIM0", 18, 1), REG_FIELD("SPIM1", 19, 1), REG_FIELD("SPIS0", 20, 1),
+	REG_FIELD("SPIS1", 21, 1), REG_FIELD("SDMMC", 22, 1), REG_FIELD("CAN0", 23, 1),
+	REG_FIELD("CAN1", 24, 1), REG_FIELD("GPIO0", 25, 1), REG_FIELD("GPIO1", 26, 1),
+	REG_FIELD("GPIO2", 27, 1), REG_FIELD("DMA", 28, 1), REG_FIELD("SDR", 29, 1)
+};
+
+static constexpr rsRegField_t rstmgrPer2modrstFields[] =
+{
+	REG_FIELD("DMAIF0", 0, 1), REG_FIELD("DMAIF1", 1, 1), REG_FIELD("DMAIF2", 2, 1),
+	REG_FIELD("DMAIF3", 3, 1), REG_FIELD("DMAIF4", 4, 1), REG_FIELD("DMAIF5", 5, 1),
+	REG_FIELD("DMAIF6", 6, 1), REG_FIELD("DMAIF7", 7, 1)
+};
+
+static constexpr rsRegField_t rstmgrBrgmodrstFields[] =
+{
+	REG_FIELD("HPS2FPGA", 0, 1),
+	REG_FIELD("LWHPS2FPGA", 1, 1),
+	REG_FIELD("FPGA2HPS", 2, 1)
+};
+
+static constexpr rsRegField_t rstmgrMiscmodrstFields[] =
+{
+	REG_FIELD("ROM", 0, 1), REG_FIELD("OCRAM", 1, 1), REG_FIELD("SYSMGR", 2, 1),
+	REG_FIELD("SYSMGRCOLD", 3, 1), REG_FIELD("FPGAMGR", 4, 1), REG_FIELD("ACPIDMAP", 5, 1),
+	REG_FIELD("S2F", 6, 1), REG_FIELD("S2FCOLD", 7, 1), REG_FIELD("NRSTPIN", 8, 1),
+	REG_FIELD("TIMESTAMPCOLD", 9, 1), REG_FIELD("CLKMGRCOLD", 10, 1), REG_FIELD("SCANMGR", 11, 1),
+	REG_FIELD("FRZCTLCOLD", 12, 1), REG_FIELD("SYSDBG", 13, 1), REG_FIELD("DBG", 14, 1),
+	REG_FIELD("TAPCOLD", 15, 1), REG_FIELD("SDRCOLD", 16, 1)
+};
+
+// System Manager
+static constexpr rsRegField_t sysmgrSiliconid1Fields[] =
+{
+	REG_FIELD("REV", 0, 16),
+	REG_FIELD("ID", 16, 16)
+};
+
+static constexpr rsRegField_t sysmgrWddbgFields[] =
+{
+	REG_FIELD("MOD_0", 0, 2),
+	REG_FIELD("MOD_1", 2, 2)
+};
+
+static constexpr rsRegField_t sysmgrBootFields[] =
+{
+	REG_FIELD_ENUM("BSEL", 0, 3, sysmgrBootBsel),
+	REG_FIELD("CSEL", 3, 2)
+};
+
+static constexpr rsRegField_t sysmgrHpsinfoFields[] =
+{
+	REG_FIELD("DUALCORE", 0, 1),
+	REG_FIELD("CAN", 1, 1)
+};
+
+static constexpr rsRegField_t sysmgrFpgaintfGblFields[] = { REG_FIELD("INTF", 0, 1) };
+
+static constexpr rsRegField_t sysmgrFpgaintfIndivFields[] =
+{
+	REG_FIELD("RSTREQINTF", 0, 1),
+	REG_FIELD("JTAGENINTF", 1, 1),
+	REG_FIELD("CFGIOINTF", 2, 1),
+	REG_FIELD("BSCANINTF", 3, 1),
+	REG_FIELD("TRACEINTF", 4, 1),
+	REG_FIELD("STMEVENTINTF", 6, 1),
+	REG_FIELD("CROSSTRIGINTF", 7, 1)
+};
+
+static constexpr rsRegField_t sysmgrFpgaintfModuleFields[] =
+{
+	REG_FIELD("EMAC_0", 2, 1),
+	REG_FIELD("EMAC_1", 3, 1)
+};
+
+/*
+* Register database (ALT_*_ADDR registers of hps.h, in the order of the addresses)
+*
+* The FPGA Manager part is generated from alt_fpgamgr.h, all other modules
+* are a hand-maintained subset with the values of hps.h and the Technical
+* Reference Manual.
+*/
+static constexpr rsReg_t regTable[] =
+{
+	FPGAMGR_REG(STAT,							fpgamgrStatFields),
+	FPGAMGR_REG(CTL,							fpgamgrCtlFields),
+	FPGAMGR_REG(DCLKCNT,						fpgamgrDclkcntFields),
+	FPGAMGR_REG(DCLKSTAT,						fpgamgrDclkstatFields),
+	FPGAMGR_REG(GPO,							fpgamgrGpoFields),
+	FPGAMGR_REG(GPI,							fpgamgrGpiFields),
+	FPGAMGR_REG(MISCI,							fpgamgrMisciFields),
+	MON_GPIO_REG(INTEN,							fpgamgrMonGpioFields),
+	MON_GPIO_REG(INTMSK,						fpgamgrMonGpioFields),
+	MON_GPIO_REG(INTTYPE_LEVEL,					fpgamgrMonGpioFields),
+	MON_GPIO_REG(INT_POL,						fpgamgrMonGpioFields),
+	MON_GPIO_REG(INTSTAT,						fpgamgrMonGpioFields),
+	MON_GPIO_REG(RAW_INTSTAT,					fpgamgrMonGpioFields),
+	MON_GPIO_REG(PORTA_EOI,						fpgamgrMonGpioFields),
+	MON_GPIO_REG(EXT_PORTA,						fpgamgrMonGpioFields),
+	MON_GPIO_REG(LS_SYNC,						fpgamgrMonLsSyncFields),
+	MON_GPIO_REG(VER_ID_CODE,					fpgamgrMonVerIdCodeFields),
+	MON_GPIO_REG(CFG_REG2,						fpgamgrMonCfgReg2Fields),
+	MON_GPIO_REG(CFG_REG1,						fpgamgrMonCfgReg1Fields),
+	REG_ENTRY("FPGAMGRDATA_DATA",				FPGAMGRDATA_BASE + ALT_FPGAMGRDATA_DATA_OFST, fpgamgrDataFields),
+	REG_ENTRY("L4WD0_WDT_CR",					0xFFD02000, l4wdCrFields),
+	REG_ENTRY("L4WD0_WDT_TORR",					0xFFD02004, l4wdTorrFields),
+	REG_ENTRY("L4WD0_WDT_CCVR",					0xFFD02008, value32Fields),
+	REG_ENTRY("L4WD0_WDT_CRR",					0xFFD0200C, l4wdCrrFields),
+	REG_ENTRY("L4WD0_WDT_STAT",					0xFFD02010, value1Fields),
+	REG_ENTRY("L4WD0_WDT_EOI",					0xFFD02014, value1Fields),
+	REG_ENTRY("L4WD1_WDT_CR",					0xFFD03000, l4wdCrFields),
+	REG_ENTRY("L4WD1_WDT_TORR",					0xFFD03004, l4wdTorrFields),
+	REG_ENTRY("L4WD1_WDT_CCVR",					0xFFD03008, value32Fields),
+	REG_ENTRY("L4WD1_WDT_CRR",					0xFFD0300C, l4wdCrrFields),
+	REG_ENTRY("L4WD1_WDT_STAT",					0xFFD03010, value1Fields),
+	REG_ENTRY("L4WD1_WDT_EOI",					0xFFD03014, value1Fields),
+	REG_ENTRY("CLKMGR_CTL",						0xFFD04000, clkmgrCtlFields),
+	REG_ENTRY("CLKMGR_BYPASS",					0xFFD04004, clkmgrBypassFields),
+	REG_ENTRY("CLKMGR_INTER",					0xFFD04008, clkmgrInterFields),
+	REG_ENTRY("CLKMGR_INTREN",					0xFFD0400C, clkmgrIntrenFields),
+	REG_ENTRY("CLKMGR_DBCTL",					0xFFD04010, clkmgrDbctlFields),
+	REG_ENTRY("CLKMGR_STAT",					0xFFD04014, clkmgrStatFields),
+	REG_ENTRY("RSTMGR_STAT",					0xFFD05000, rstmgrStatFields),
+	REG_ENTRY("RSTMGR_CTL",						0xFFD05004, rstmgrCtlFields),
+	REG_ENTRY("RSTMGR_COUNTS",					0xFFD05008, rstmgrCountsFields),
+	REG_ENTRY("RSTMGR_MPUMODRST",				0xFFD05010, rstmgrMpumodrstFields),
+	REG_ENTRY("RSTMGR_PERMODRST",				0xFFD05014, rstmgrPermodrstFields),
+	REG_ENTRY("RSTMGR_PER2MODRST",				0xFFD05018, rstmgrPer2modrstFields),
+	REG_ENTRY("RSTMGR_BRGMODRST",				0xFFD0501C, rstmgrBrgmodrstFields),
+	REG_ENTRY("RSTMGR_MISCMODRST",				0xFFD05020, rstmgrMiscmodrstFields),
+	REG_ENTRY("SYSMGR_SILICONID1",				0xFFD08000, sysmgrSiliconid1Fields),
+	REG_ENTRY("SYSMGR_WDDBG",					0xFFD08010, sysmgrWddbgFields),
+	REG_ENTRY("SYSMGR_BOOT",					0xFFD08014, sysmgrBootFields),
+	REG_ENTRY("SYSMGR_HPSINFO",					0xFFD08018, sysmgrHpsinfoFields),
+	REG_ENTRY("SYSMGR_FPGAINTF_GBL",			0xFFD08020, sysmgrFpgaintfGblFields),
+	REG_ENTRY("SYSMGR_FPGAINTF_INDIV",			0xFFD08024, sysmgrFpgaintfIndivFields),
+	REG_ENTRY("SYSMGR_FPGAINTF_MODULE",			0xFFD08028, sysmgrFpgaintfModuleFields)
+};
+
+static constexpr size_t REG_COUNT = sizeof(regTable) / sizeof(regTable[0]);
+
+/*
+* Perfect hash of the register names ("hash and displace")
+*
+* The hash with seed 0 selects a bucket, the seed of the bucket places
+* the name on its own slot. The seeds are searched by the compiler, a
+* lookup costs two hashes of the name and one string compare.
+*/
+
+static constexpr size_t nextPow2(size_t n)
+{
+	size_t p = 1;
+	while (p < n) p <<= 1;
+	return p;
+}
+
+static constexpr size_t HASH_BUCKETS = (REG_COUNT + 1) / 2;
+static constexpr size_t HASH_SLOTS = nextPow2(2 * REG_COUNT);
+static constexpr uint8_t HASH_EMPTY = 0xFF;
+
+static_assert(REG_COUNT < HASH_EMPTY, "the register index does not fit into the hash slots");
+
+static constexpr char foldChar(char c)
+{
+	return ((c >= 'a') && (c <= 'z')) ? (char) (c - 'a' + 'A') : c;
+}
+
+static constexpr size_t nameLen(const char* name)
+{
+	size_t len = 0;
+	while (name[len] != '\0') len++;
+	return len;
+}
+
+static constexpr uint64_t hashName(const char* name, size_t len)
+{
+	// FNV-1a of the upper case name
+	uint64_t h = 0xCBF29CE484222325ULL;
+	for (size_t i = 0; i < len; i++)
+		h = (h ^ (uint8_t) foldChar(name[i])) * 0x100000001B3ULL;
+	return h;
+}
+
+static constexpr size_t hashBucket(uint64_t h)
+{
+	return (size_t) ((h >> 32) % HASH_BUCKETS);
+}
+
+static constexpr size_t hashSlot(uint64_t h, uint32_t seed)
+{
+	// The seed is mixed into the hash of the name, the name is only hashed once
+	h ^= seed * 0x9E3779B97F4A7C15ULL;
+	h ^= h >> 31;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 29;
+	return (size_t) (h & (HASH_SLOTS - 1));
+}
+
+typedef struct
+{
+	uint16_t seed[HASH_BUCKETS];	// seed of every bucket
+	uint8_t slot[HASH_SLOTS];		// index of the register or HASH_EMPTY
+	bool valid;						// a seed was found for every bucket
+} regHash_t;
+
+static constexpr regHash_t buildRegHash(void)
+{
+	regHash_t hash {};
+	uint64_t nameHash[REG_COUNT] {};
+	uint8_t bucketOf[REG_COUNT] {};
+	uint8_t bucketSize[HASH_BUCKETS] {};
+	size_t maxSize = 0;
+
+	for (size_t i = 0; i < HASH_SLOTS; i++)
+		hash.slot[i] = HASH_EMPTY;
+
+	for (size_t i = 0; i < REG_COUNT; i++)
+	{
+		const char* name = regTable[i].name;
+		nameHash[i] = hashName(name, nameLen(name));
+		bucketOf[i] = hashBucket(nameHash[i]);
+		bucketSize[bucketOf[i]]++;
+		if (bucketSize[bucketOf[i]] > maxSize) maxSize = bucketSize[bucketOf[i]];
+	}
+
+	// The largest buckets are placed first, while most slots are still free
+	for (size_t size = maxSize; size > 0; size--)
+	{
+		for (size_t b = 0; b < HASH_BUCKETS; b++)
+		{
+			if (bucketSize[b] != size) continue;
+
+			bool placed = false;
+			for (uint32_t seed = 1; (seed <= 0xFFFF) && !placed; seed++)
+			{
+				// Try to place all names of the bucket, undo on a collision
+				placed = true;
+				for (size_t i = 0; (i < REG_COUNT) && placed; i++)
+				{
+					if (bucketOf[i] != b) continue;
+					size_t s = hashSlot(nameHash[i], seed);
+					if (hash.slot[s] != HASH_EMPTY)
+						placed = false;
+					else
+						hash.slot[s] = (uint8_t) i;
+				}
+				if (!placed)
+				{
+					for (size_t s = 0; s < HASH_SLOTS; s++)
+						if ((hash.slot[s] != HASH_EMPTY) && (bucketOf[hash.slot[s]] == b))
+							hash.slot[s] = HASH_EMPTY;
+				}
+				else
+					hash.seed[b] = (uint16_t) seed;
+			}
+			// Identical names can never be placed
+			if (!placed) return hash;
+		}
+	}
+	hash.valid = true;
+	return hash;
+}
+
+static constexpr regHash_t regHash = buildRegHash();
+static_assert(regHash.valid, "no perfect hash for the register names (duplicated name?)");
+
+/*
+*   @brief               Compare two names case-insensitive
+*/
+static bool equalName(const char* a, const char* b, size_t len)
+{
+	for (size_t i = 0; i < len; i++)
+		if (foldChar(a[i]) != foldChar(b[i])) return false;
+	return true;
+}
+
+const rsReg_t* rsRegFind(const char* name, size_t len)
+{
+	if ((len > 4) && equalName(name, "ALT_", 4))
+	{
+		name += 4;
+		len -= 4;
+	}
+
+	uint64_t h = hashName(name, len);
+	uint8_t index = regHash.slot[hashSlot(h, regHash.seed[hashBucket(h)])];
+	if (index == HASH_EMPTY) return nullptr;
+
+	const rsReg_t* reg = &regTable[index];
+	if (!equalName(reg->name, name, len) || (reg->name[len] != '\0'))
+		return nullptr;
+	return reg;
+}
+
+const rsRegField_t* rsRegFindField(const rsReg_t* reg, const char* name, size_t len)
+{
+	// A register has only a few fields
+	for (uint8_t i = 0; i < reg->fieldCount; i++)
+	{
+		const rsRegField_t* field = &reg->fields[i];
+		if ((strlen(field->name) == len) && equalName(field->name, name, len))
+			return field;
+		if ((field->alias != nullptr) && (strlen(field->alias) == len) && equalName(field->alias, name, len))
+			return field;
+	}
+	return nullptr;
+}
+
+int rsRegParse(const char* spec, const rsReg_t** reg, const rsRegField_t** field)
+{
+	const char* dot = strchr(spec, '.');
+	size_t regLen = (dot != nullptr) ? (size_t) (dot - spec) : strlen(spec);
+
+	*field = nullptr;
+	*reg = rsRegFind(spec, regLen);
+	if (*reg == nullptr) return RSMEM_ERR_INPUT;
+
+	if (dot != nullptr)
+	{
+		*field = rsRegFindField(*reg, dot + 1, strlen(dot + 1));
+		if (*field == nullptr) return RSMEM_ERR_INPUT;
+	}
+	return RSMEM_SUCCESS;
+}
+
+uint32_t rsRegFieldMask(const rsRegField_t* field)
+{
+	uint32_t bits = (field->width >= 32) ? 0xFFFFFFFF : ((1u << field->width) - 1);
+	return bits << field->lsb;
+}
+
+uint32_t rsRegFieldGet(const rsRegField_t* field, uint32_t regValue)
+{
+	return (regValue & rsRegFieldMask(field)) >> field->lsb;
+}
+
+const char* rsRegEnumName(const rsRegField_t* field, uint32_t fieldValue)
+{
+	for (uint8_t i = 0; i < field->enumCount; i++)
+		if (field->enums[i].value == fieldValue)
+			return field->enums[i].name;
+	return nullptr;
+}
+
+size_t rsRegCount(void)
+{
+	return REG_COUNT;
+}
+
+const rsReg_t* rsRegAt(size_t index)
+{
+	return (index < REG_COUNT) ? &regTable[index] : nullptr;
+}
@@ -0,0 +1,117 @@
+/**
+ *
+ * @file    rstools_regs.h
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools register database of the HPS (name -> address, width, fields)
+ *
+ * The names are the ALT_* register names of hps.h without the "ALT_"
+ * prefix (e.g. "FPGAMGR_STAT", "RSTMGR_BRGMODRST", "L4WD0_WDT_CR").
+ * The FPGA Manager registers and fields are built from the *_OFST, *_LSB
+ * and *_WIDTH macros of alt_fpgamgr.h. The other modules (watchdogs, Clock,
+ * Reset and System Manager) are a hand-maintained subset that follows hps.h
+ * and the Cyclone V HPS Technical Reference Manual. A register is selected with
+ * "REG" or "REG.FIELD", the names are case-insensitive and the "ALT_"
+ * prefix is optional.
+ *
+ * The lookup uses a perfect hash table that is built by the compiler, the
+ * database is constant data without any initialization at startup.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		FPGA Manager registers and fields from the macros of alt_fpgamgr.h
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef RSTOOLS_REGS_H
+#define RSTOOLS_REGS_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <cstddef>
+
+/*
+* Named value of a register field
+*/
+typedef struct
+{
+	uint32_t value;
+	const char* name;				// e.g. "USERMOD"
+} rsRegEnum_t;
+
+/*
+* Bit field of a register
+*/
+typedef struct
+{
+	const char* name;				// e.g. "MSEL"
+	const char* alias;				// second name or nullptr (e.g. "MODE" for "MOD")
+	uint8_t lsb;					// first bit
+	uint8_t width;					// number of bits
+	const rsRegEnum_t* enums;		// named values or nullptr
+	uint8_t enumCount;
+} rsRegField_t;
+
+/*
+* Register of the database
+*/
+typedef struct
+{
+	const char* name;				// e.g. "FPGAMGR_STAT"
+	uint32_t address;				// physical address
+	uint8_t width;					// register width in bits
+	const rsRegField_t* fields;		// fields in the order of the bits
+	uint8_t fieldCount;
+} rsReg_t;
+
+/*
+*   @brief               Find a register by its name
+*   @param	name		 register name (case-insensitive, optional "ALT_" prefix)
+*   @param	len			 length of the name
+*   @return              register or nullptr
+*/
+const rsReg_t* rsRegFind(const char* name, size_t len);
+
+/*
+*   @brief               Find a field of a register by its name or alias
+*   @return              field or nullptr
+*/
+const rsRegField_t* rsRegFindField(const rsReg_t* reg, const char* name, size_t len);
+
+/*
+*   @brief               Read a register selection "REG" or "REG.FIELD"
+*   @param	spec		 selection typed by the user
+*   @param	reg			 selected register
+*   @param	field		 selected field or nullptr for the whole register
+*   @return              RSMEM_SUCCESS or RSMEM_ERR_INPUT
+*/
+int rsRegParse(const char* spec, const rsReg_t** reg, const rsRegField_t** field);
+
+/*
+*   @brief               Mask of a field in the register
+*/
+uint32_t rsRegFieldMask(const rsRegField_t* field);
+
+/*
+*   @brief               Value of a field (shifted to bit 0)
+*/
+uint32_t rsRegFieldGet(const rsRegField_t* field, uint32_t regValue);
+
+/*
+*   @brief               Name of a field value
+*   @return              name or nullptr if the value has no name
+*/
+const char* rsRegEnumName(const rsRegField_t* field, uint32_t fieldValue);
+
+/*
+*   @brief               All registers of the database (in the order of the addresses)
+*/
+size_t rsRegCount(void);
+const rsReg_t* rsRegAt(size_t index);
+
+#endif // RSTOOLS_REGS_H
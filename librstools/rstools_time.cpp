@@ -0,0 +1,69 @@
+/**
+ *
+ * @file    rstools_time.cpp
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools monotonic timestamps and precise periodic waiting
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Raw monotonic clock for latency measurements
+ * 		1.20 (10-16-2026)
+ * 		Early return of the wait on a stop request of the caller
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#include "rstools_time.h"
+
+#include <cerrno>
+#include <time.h>					// POSIX: clock_gettime, clock_nanosleep
+
+uint64_t rsTimeNowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+uint64_t rsTimeRawNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+uint64_t rsTimeWaitUntilNs(uint64_t deadline, const volatile sig_atomic_t* stop)
+{
+	uint64_t now = rsTimeNowNs();
+	if ((stop != nullptr) && *stop) return now;
+
+	// Sleep the long part of the wait with an absolute deadline
+	if (now + RSTIME_SPIN_NS < deadline)
+	{
+		uint64_t wake = deadline - RSTIME_SPIN_NS;
+		struct timespec ts;
+		ts.tv_sec  = wake / 1000000000ULL;
+		ts.tv_nsec = wake % 1000000000ULL;
+		// A signal only continues the sleep if the caller did not request a stop,
+		// after any other error the rest is busy-waited
+		int res;
+		do
+		{
+			res = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr);
+			if ((stop != nullptr) && *stop) return rsTimeNowNs();
+		} while (res == EINTR);
+		now = rsTimeNowNs();
+	}
+
+	// Busy-wait the rest
+	while ((now < deadline) && !((stop != nullptr) && *stop))
+		now = rsTimeNowNs();
+
+	return now;
+}
@@ -0,0 +1,59 @@
+/**
+ *
+ * @file    rstools_time.h
+ * @brief   librstools
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools monotonic timestamps and precise periodic waiting
+ *
+ * The scheduler can not wake up a task with microsecond precision.
+ * For short remaining times the wait functions therefore busy-wait on
+ * the monotonic clock, longer times are slept with an absolute deadline
+ * so that the period does not drift.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Raw monotonic clock for latency measurements
+ * 		1.20 (10-16-2026)
+ * 		Early return of the wait on a stop request of the caller
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#ifndef RSTOOLS_TIME_H
+#define RSTOOLS_TIME_H
+
+#include <cstdint>                  // Standard integral types (uint8_t,...)
+#include <csignal>					// sig_atomic_t
+
+// Remaining time below that the wait functions busy-wait instead of sleeping
+#define RSTIME_SPIN_NS		200000ULL
+
+/*
+*   @brief               Read the monotonic clock (CLOCK_MONOTONIC)
+*   @return              time in ns
+*/
+uint64_t rsTimeNowNs(void);
+
+/*
+*   @brief               Read the raw monotonic clock (CLOCK_MONOTONIC_RAW)
+*						 Not slewed by NTP, for measuring short intervals
+*   @return              time in ns
+*/
+uint64_t rsTimeRawNs(void);
+
+/*
+*   @brief               Wait until the monotonic clock reached a deadline
+*						 The last RSTIME_SPIN_NS are busy-waited
+*   @param	deadline	 deadline in ns of rsTimeNowNs()
+*   @param	stop		 stop flag of the caller (e.g. set by a SIGINT handler),
+*						 the wait returns early when it is set (nullptr: no early return)
+*   @return              time in ns after the wait
+*/
+uint64_t rsTimeWaitUntilNs(uint64_t deadline, const volatile sig_atomic_t* stop = nullptr);
+
+#endif // RSTOOLS_TIME_H
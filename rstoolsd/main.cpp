@@ -0,0 +1,468 @@
+/**
+ *
+ * @file    main.cpp
+ * @brief   rstoolsd
+ * @author  rsyocto GmbH & Co. KG
+ * 			Robin Sebastian (git@robseb.de)
+ * @mainpage
+ * rstools daemon serving register operations over a Unix domain socket
+ *
+ * The daemon opens the memory driver once and keeps the windows of the
+ * Lightweight HPS-to-FPGA Bridge, the HPS-to-FPGA Bridge, the FPGA Manager,
+ * the System Manager and the Reset Manager mapped. The rstools applications
+ * use it if the environment variable RSTOOLS_SOCKET is set, e.g.:
+ * 		rstoolsd &
+ * 		export RSTOOLS_SOCKET=/run/rstools/rstoolsd.sock
+ * 		FPGA-writeBridge -s script.txt
+ *
+ * Requests are served one message at a time, a FPGA configuration blocks
+ * all other clients until it is done.
+ *
+ * Change Log:
+ * 		1.00 (10-16-2026)
+ * 		Initial release
+ * 		1.10 (10-16-2026)
+ * 		Block write requests and a limit of the response message
+ * 		1.20 (10-16-2026)
+ * 		Store width of the block write requests
+ *
+ * Copyright (C) 2020-2022 rsyocto GmbH & Co. KG  *  All Rights Reserved
+ *
+ */
+
+#define VERSION "1.20"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>					// POSIX: read, close, unlink, fork
+#include <fcntl.h>					// POSIX: open
+#include <poll.h>					// POSIX: poll
+#include <sys/socket.h>				// POSIX: socket, bind, listen, accept
+#include <sys/un.h>					// POSIX: sockaddr_un
+#include <sys/stat.h>				// POSIX: mkdir, chmod
+#include <sys/wait.h>				// POSIX: waitpid
+#include "rstools_mem.h"			// rstools shared register access layer
+#include "rstools_proto.h"			// rstoolsd protocol
+#include "rstools_client.h"			// socket path
+
+using namespace std;
+
+// Maximal number of connected clients
+#define RSTOOLSD_MAX_CLIENTS		32
+// Time a client may take to send the rest of a started message
+#define RSTOOLSD_RECV_TIMEOUT_MS	1000
+// Application that writes a FPGA configuration
+#define RSTOOLSD_CONFIG_APP			"FPGA-writeConfig"
+
+// FPGA Manager (incl. the monitor registers) and FPGA Manager data port
+#define REG_FPGAMGR_BASE			0xFF706000
+#define REG_FPGAMGR_SPAN			0x1000
+#define REG_FPGAMGRDATA_BASE		0xFFB90000
+#define REG_FPGAMGRDATA_SPAN		0x1000
+// System Manager
+#define REG_SYSMGR_BASE				0xFFD08000
+#define REG_SYSMGR_SPAN				0x4000
+// Reset Manager
+#define REG_RSTMGR_BASE				0xFFD05000
+#define REG_RSTMGR_SPAN				0x1000
+
+/*
+* Window that is mapped at the start
+*/
+typedef struct
+{
+	const char* name;
+	uint32_t base;
+	uint32_t span;
+} premapWindow_t;
+
+static const premapWindow_t premap[] =
+{
+	{ "Lightweight HPS-to-FPGA Bridge",	LWHPSFPGA_OFST,			LWH2F_RANGE + 1 },
+	{ "HPS-to-FPGA Bridge",				HPSFPGA_OFST,			H2F_RANGE + 1 },
+	{ "FPGA Manager",					REG_FPGAMGR_BASE,		REG_FPGAMGR_SPAN },
+	{ "FPGA Manager Data",				REG_FPGAMGRDATA_BASE,	REG_FPGAMGRDATA_SPAN },
+	{ "System Manager",					REG_SYSMGR_BASE,		REG_SYSMGR_SPAN },
+	{ "Reset Manager",					REG_RSTMGR_BASE,		REG_RSTMGR_SPAN }
+};
+
+/*
+* Global Values
+*/
+
+static volatile sig_atomic_t stopRequest = 0;
+static uint64_t servedMessages = 0;
+static uint64_t servedRequests = 0;
+
+static void onSignal(int)
+{
+	stopRequest = 1;
+}
+
+/*
+*   @brief               Write a FPGA configuration with FPGA-writeConfig
+*   @param	path		 configuration file
+*   @param	flags		 RSPROTO_CONFIG_... flags
+*   @return              RSMEM_SUCCESS or RSPROTO_ERR_CONFIG
+*/
+static int runConfig(const string& path, uint32_t flags)
+{
+	int out[2];
+	if (pipe2(out, O_CLOEXEC) != 0) return RSPROTO_ERR_CONFIG;
+
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		close(out[0]);
+		close(out[1]);
+		return RSPROTO_ERR_CONFIG;
+	}
+	if (pid == 0)
+	{
+		// The child accesses the memory driver itself
+		dup2(out[1], STDOUT_FILENO);
+		vector<const char*> args = { RSTOOLSD_CONFIG_APP, "-f", path.c_str(), "-b" };
+		if (flags & RSPROTO_CONFIG_CACHE) args.push_back("-cache");
+		if (flags & RSPROTO_CONFIG_FORCE) args.push_back("-force");
+		if (flags & RSPROTO_CONFIG_DMA)   args.push_back("-dma");
+		args.push_back(nullptr);
+		execvp(RSTOOLSD_CONFIG_APP, (char* const*) args.data());
+		_exit(127);
+	}
+	close(out[1]);
+
+	// The decimal output of FPGA-writeConfig ends with the result (1: success)
+	string output;
+	char buf[256];
+	ssize_t len;
+	while ((len = read(out[0], buf, sizeof(buf))) != 0)
+	{
+		if (len < 0)
+		{
+			if (errno == EINTR) continue;
+			break;
+		}
+		output.append(buf, len);
+	}
+	close(out[0]);
+
+	int status;
+	while ((waitpid(pid, &status, 0) < 0) && (errno == EINTR)) {}
+
+	size_t last = output.find_last_not_of(" \r\n");
+	bool success = WIFEXITED(status) && (WEXITSTATUS(status) == 0) && \
+		(last != string::npos) && (output[last] == '1');
+	return success ? RSMEM_SUCCESS : RSPROTO_ERR_CONFIG;
+}
+
+/*
+*   @brief               Execute one request and append the response
+*   @param	req			 request
+*   @param	payload		 payload of the request
+*   @param	tx			 response message
+*   @param	txLimit		 maximal size of the response message after this request
+*/
+static void executeRequest(const rsProtoReq_t& req, const uint8_t* payload, vector<uint8_t>& tx, size_t txLimit)
+{
+	rsProtoResp_t resp;
+	resp.status = RSMEM_SUCCESS;
+	resp.value = 0;
+
+	bool aligned = ((req.address % 4) == 0);
+	switch (req.op)
+	{
+	case RSPROTO_OP_NOP:
+		break;
+	case RSPROTO_OP_READ:
+	{
+		uint32_t value = 0;
+		resp.status = aligned ? rsMemRead(req.address, &value) : RSMEM_ERR_INPUT;
+		resp.value = value;
+		break;
+	}
+	case RSPROTO_OP_WRITE:
+		resp.status = aligned ? rsMemWrite(req.address, req.value) : RSMEM_ERR_INPUT;
+		break;
+	case RSPROTO_OP_SET:
+		resp.status = aligned ? rsMemSetBits(req.address, req.value) : RSMEM_ERR_INPUT;
+		break;
+	case RSPROTO_OP_CLEAR:
+		resp.status = aligned ? rsMemClearBits(req.address, req.value) : RSMEM_ERR_INPUT;
+		break;
+	case RSPROTO_OP_DUMP:
+	{
+		// The response message is limited like the request (the client rejects more)
+		if (!aligned || (req.value % 4 != 0) || (req.value > RSPROTO_MAX_DUMP) || \
+			((uint64_t) req.address + req.value > 0x100000000ULL) || \
+			(tx.size() + sizeof(resp) + req.value > txLimit))
+		{
+			resp.status = RSMEM_ERR_INPUT;
+			break;
+		}
+		// The data follows the response
+		size_t pos = tx.size();
+		tx.resize(pos + sizeof(resp) + req.value);
+		resp.status = rsMemReadBlock(req.address, tx.data() + pos + sizeof(resp), req.value);
+		if (resp.status == RSMEM_SUCCESS)
+			resp.value = req.value;
+		else
+			tx.resize(pos + sizeof(resp));
+		memcpy(tx.data() + pos, &resp, sizeof(resp));
+		return;
+	}
+	case RSPROTO_OP_WRITE_BLOCK:
+	{
+		if (!aligned || (req.length % 4 != 0) || \
+			((uint64_t) req.address + req.length > 0x100000000ULL))
+		{
+			resp.status = RSMEM_ERR_INPUT;
+			break;
+		}
+		// The payload is not aligned inside the request message
+		static vector<uint64_t> words(RSPROTO_MAX_PAYLOAD / 8);
+		memcpy(words.data(), payload, req.length);
+		uint32_t width = (req.value == 0) ? 32 : req.value;
+		resp.status = (width > 128) ? RSMEM_ERR_INPUT : \
+			rsMemWriteBlock(req.address, words.data(), req.length, (uint8_t) width);
+		break;
+	}
+	case RSPROTO_OP_CONFIG:
+		if (req.length == 0)
+			resp.status = RSMEM_ERR_INPUT;
+		else
+			resp.status = runConfig(string((const char*) payload, req.length), req.value);
+		break;
+	default:
+		resp.status = RSMEM_ERR_INPUT;
+		break;
+	}
+
+	size_t pos = tx.size();
+	tx.resize(pos + sizeof(resp));
+	memcpy(tx.data() + pos, &resp, sizeof(resp));
+}
+
+/*
+*   @brief               Receive one message of a client, execute it and send the responses
+*   @param	fd			 client socket
+*   @param	rx			 request buffer
+*   @param	tx			 response buffer
+*   @return              false if the connection must be closed
+*/
+static bool serveMessage(int fd, vector<uint8_t>& rx, vector<uint8_t>& tx)
+{
+	rsProtoHeader_t header;
+	if (!rsProtoRecvFull(fd, &header, sizeof(header)))
+		return false;
+	if ((header.magic != RSPROTO_MAGIC) || (header.count > RSPROTO_MAX_BATCH) || \
+		(header.length > RSPROTO_MAX_MESSAGE))
+		return false;
+
+	rx.resize(header.length);
+	if (!rsProtoRecvFull(fd, rx.data(), header.length))
+		return false;
+
+	tx.resize(sizeof(rsProtoHeader_t));
+	const uint8_t* ptr = rx.data();
+	const uint8_t* end = ptr + header.length;
+	for (uint16_t i = 0; i < header.count; i++)
+	{
+		rsProtoReq_t req;
+		if (ptr + sizeof(req) > end) return false;
+		memcpy(&req, ptr, sizeof(req));
+		ptr += sizeof(req);
+		if ((req.length > RSPROTO_MAX_PAYLOAD) || (ptr + req.length > end)) return false;
+
+		// Space for the responses of the following requests is kept free
+		size_t txLimit = sizeof(header) + RSPROTO_MAX_MESSAGE - (header.count - i - 1) * sizeof(rsProtoResp_t);
+		executeRequest(req, ptr, tx, txLimit);
+		ptr += req.length;
+	}
+
+	header.length = tx.size() - sizeof(header);
+	memcpy(tx.data(), &header, sizeof(header));
+	servedMessages++;
+	servedRequests += header.count;
+	return rsProtoSendFull(fd, tx.data(), tx.size());
+}
+
+/*
+*   @brief               Create the listening socket (only accessible by the owner)
+*   @param	path		 socket path
+*   @return              socket or -1
+*/
+static int openListener(const char* path)
+{
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path)) return -1;
+	strcpy(addr.sun_path, path);
+
+	// Create the directory of the default socket
+	string dir(path);
+	size_t slash = dir.rfind('/');
+	if ((slash != string::npos) && (slash > 0))
+		mkdir(dir.substr(0, slash).c_str(), 0755);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0) return -1;
+
+	// Remove the socket of a previous daemon
+	unlink(path);
+	mode_t mask = umask(0077);
+	int res = bind(fd, (struct sockaddr*) &addr, sizeof(addr));
+	umask(mask);
+	if ((res != 0) || (listen(fd, RSTOOLSD_MAX_CLIENTS) != 0))
+	{
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+/*
+*   @brief               Open the memory driver and map the windows of the daemon
+*	@param	ConsloeOutput	Print Status Output to Console
+*   @return              success
+*/
+static bool mapWindows(bool ConsloeOutput)
+{
+	if (rsMemOpen() != RSMEM_SUCCESS)
+	{
+		cout << "[ ERROR ] Failed to open the memory driver!" << endl;
+		return false;
+	}
+
+	for (size_t i = 0; i < sizeof(premap) / sizeof(premap[0]); i++)
+	{
+		// Other addresses are mapped at the first access
+		if (rsMemMap(premap[i].base, premap[i].span) == nullptr)
+			cout << "[ WARNING ] Failed to map the " << premap[i].name << endl;
+		else if (ConsloeOutput)
+			cout << "[ INFO ] " << premap[i].name << ": 0x" << hex << premap[i].base << " (" << dec \
+				 << premap[i].span / 1024 << " KiB)" << endl;
+	}
+	return true;
+}
+
+/*
+*   @brief               Serve the clients until SIGINT or SIGTERM
+*   @param	listenFd	 listening socket
+*/
+static void serve(int listenFd)
+{
+	vector<struct pollfd> fds;
+	fds.push_back({ listenFd, POLLIN, 0 });
+	vector<uint8_t> rx;
+	vector<uint8_t> tx;
+
+	while (!stopRequest)
+	{
+		if (poll(fds.data(), fds.size(), -1) < 0)
+		{
+			if (errno == EINTR) continue;
+			break;
+		}
+
+		// Clients first, a new connection is served in the next round
+		for (size_t i = fds.size(); i-- > 1; )
+		{
+			if (fds[i].revents == 0) continue;
+			if ((fds[i].revents & POLLIN) && serveMessage(fds[i].fd, rx, tx))
+				continue;
+			close(fds[i].fd);
+			fds.erase(fds.begin() + i);
+		}
+
+		if (fds[0].revents & POLLIN)
+		{
+			int fd = accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+			if (fd < 0) continue;
+			if (fds.size() > RSTOOLSD_MAX_CLIENTS)
+			{
+				close(fd);
+				continue;
+			}
+			// A client that stops inside a message must not block the daemon
+			struct timeval tmo = { RSTOOLSD_RECV_TIMEOUT_MS / 1000, (RSTOOLSD_RECV_TIMEOUT_MS % 1000) * 1000 };
+			setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tmo, sizeof(tmo));
+			setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tmo, sizeof(tmo));
+			fds.push_back({ fd, POLLIN, 0 });
+		}
+	}
+
+	for (size_t i = 1; i < fds.size(); i++)
+		close(fds[i].fd);
+}
+
+int main(int argc, const char* argv[])
+{
+	bool ConsloeOutput = true;
+	string socketPath = rsClientSocketPath();
+
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		if (arg == "-h")
+		{
+			cout << "	Daemon serving register operations of the rstools over a Unix domain socket" << endl;
+			cout << "	rstoolsd {-s [socket path] [optional]} {-q [optional]}" << endl;
+			cout << "		-s => socket (default: $" << RSPROTO_ENV_SOCKET << " or " << RSPROTO_DEFAULT_SOCKET << ")" << endl;
+			cout << "		-q => no status output" << endl;
+			cout << "	The rstools use the daemon with: export " << RSPROTO_ENV_SOCKET << "=" << RSPROTO_DEFAULT_SOCKET << endl;
+			cout << endl << "Vers.: " << VERSION << endl;
+			cout << "Copyright (C) 2020-2022 rsyocto GmbH & Co. KG" << endl;
+			return 0;
+		}
+		else if ((arg == "-s") && (i + 1 < argc))
+			socketPath = argv[++i];
+		else if (arg == "-q")
+			ConsloeOutput = false;
+		else
+		{
+			cout << "[ ERROR ] Unknown option: " << arg << endl;
+			return 1;
+		}
+	}
+
+	// The daemon itself accesses the memory driver
+	unsetenv(RSPROTO_ENV_SOCKET);
+	if (!mapWindows(ConsloeOutput))
+		return 1;
+
+	int listenFd = openListener(socketPath.c_str());
+	if (listenFd < 0)
+	{
+		cout << "[ ERROR ] Failed to open the socket " << socketPath << "!" << endl;
+		rsMemClose();
+		return 1;
+	}
+
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = onSignal;
+	sigaction(SIGINT, &sa, nullptr);
+	sigaction(SIGTERM, &sa, nullptr);
+	signal(SIGPIPE, SIG_IGN);
+
+	if (ConsloeOutput)
+		cout << "[ INFO ] rstoolsd is listening on " << socketPath << endl;
+
+	serve(listenFd);
+
+	close(listenFd);
+	unlink(socketPath.c_str());
+	rsMemClose();
+
+	if (ConsloeOutput)
+		cout << "[ INFO ] rstoolsd stopped after " << servedMessages << " messages with " \
+			 << servedRequests << " requests" << endl;
+	return 0;
+}